@@ -25,6 +25,8 @@
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/gfx/allegro_bitmap.h"
 #include "ags/shared/script/cc_common.h"
+#include "ags/engine/script/cc_instance.h"
+#include "common/algorithm.h"
 #include "image/png.h"
 
 namespace AGS {
@@ -33,8 +35,10 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_debug_groups_list",   WRAP_METHOD(AGSConsole, Cmd_listDebugGroups));
 	registerCmd("ags_debug_groups_set",  WRAP_METHOD(AGSConsole, Cmd_setDebugGroupLevel));
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
+	registerCmd("ags_script_profile", WRAP_METHOD(AGSConsole, Cmd_ScriptProfile));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache_stats", WRAP_METHOD(AGSConsole, Cmd_spriteCacheStats));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -184,6 +188,47 @@ bool AGSConsole::Cmd_SetScriptDump(int argc, const char **argv) {
 	return true;
 }
 
+static bool compareProfileEntries(const AGS3::ScriptProfile::Entry *a, const AGS3::ScriptProfile::Entry *b) {
+	if (a->TimeMs != b->TimeMs)
+		return a->TimeMs > b->TimeMs;
+	return a->Instructions > b->Instructions;
+}
+
+bool AGSConsole::Cmd_ScriptProfile(int argc, const char **argv) {
+	AGS3::ScriptProfile &profile = _GP(scriptProfile);
+	if (argc < 2 || argc > 3) {
+		debugPrintf("Usage: %s on|off|reset|show [count]\n", argv[0]);
+		debugPrintf("Script profiling is %s\n", profile.Enabled ? "on" : "off");
+		return true;
+	}
+
+	if (strcmp(argv[1], "on") == 0) {
+		profile.Enabled = true;
+	} else if (strcmp(argv[1], "off") == 0) {
+		profile.Enabled = false;
+	} else if (strcmp(argv[1], "reset") == 0) {
+		profile.Entries.clear();
+		profile.InstructionCount = 0;
+	} else if (strcmp(argv[1], "show") == 0) {
+		Common::Array<const AGS3::ScriptProfile::Entry *> entries;
+		for (const auto &it : profile.Entries)
+			entries.push_back(&it._value);
+		Common::sort(entries.begin(), entries.end(), compareProfileEntries);
+
+		uint count = (argc == 3) ? atoi(argv[2]) : 20;
+		debugPrintf("%-24s %-32s %8s %10s %14s\n", "Script", "Function", "Calls", "Time (ms)", "Instructions");
+		for (uint i = 0; i < entries.size() && i < count; ++i) {
+			const AGS3::ScriptProfile::Entry *entry = entries[i];
+			debugPrintf("%-24s %-32s %8u %10u %14llu\n", entry->Section.GetCStr(), entry->Function.GetCStr(),
+				entry->Calls, entry->TimeMs, (unsigned long long)entry->Instructions);
+		}
+		debugPrintf("%llu instructions run while profiling\n", (unsigned long long)profile.InstructionCount);
+	} else {
+		debugPrintf("Unknown option '%s'\n", argv[1]);
+	}
+	return true;
+}
+
 bool AGSConsole::Cmd_getSpriteInfo(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Usage: %s SpriteNumber\n", argv[0]);
@@ -244,6 +289,29 @@ bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_spriteCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	AGS3::Shared::SpriteCache &cache = _GP(spriteset);
+	if (argc == 2) {
+		cache.ResetStatistics();
+		return true;
+	}
+
+	const AGS3::Shared::SpriteCache::Statistics &stats = cache.GetStatistics();
+	const uint32 requests = stats.Hits + stats.Loads + stats.Restores;
+	debugPrintf("Cache: %u KB of %u KB (%u KB locked)\n", (uint)(cache.GetCacheSize() / 1024),
+		(uint)(cache.GetMaxCacheSize() / 1024), (uint)(cache.GetLockedSize() / 1024));
+	debugPrintf("Compressed copies: %u KB of %u KB (%u KB waiting)\n", (uint)(cache.GetCompressedSize() / 1024),
+		(uint)(cache.GetMaxCompressedSize() / 1024), (uint)(cache.GetPendingCompressSize() / 1024));
+	debugPrintf("Requests: %u, hits: %u (%u%%), restored: %u, loaded: %u, prefetched: %u\n",
+		requests, stats.Hits, requests ? stats.Hits * 100 / requests : 0, stats.Restores, stats.Loads, stats.Prefetches);
+	return true;
+}
+
 LogOutputTarget::LogOutputTarget() {
 }
 
@@ -410,6 +410,33 @@ static void reset_temp_room() {
 	_GP(troom) = RoomStatus();
 }
 
+// Loads the sprites that the room objects and the characters in the room
+// are going to show first, so that they are not loaded one by one during
+// the first game frames
+static void prefetch_room_sprites() {
+	for (int cc = 0; cc < _G(croom)->numobj; cc++) {
+		const RoomObject &obj = _G(objs)[cc];
+		if (!obj.on)
+			continue;
+		_GP(spriteset).Prefetch(obj.num);
+		if (obj.view < _GP(game).numviews && obj.loop < _GP(views)[obj.view].numLoops) {
+			const ViewLoopNew &loop = _GP(views)[obj.view].loops[obj.loop];
+			for (int f = 0; f < loop.numFrames; f++)
+				_GP(spriteset).Prefetch(loop.frames[f].pic);
+		}
+	}
+	for (int cc = 0; cc < _GP(game).numcharacters; cc++) {
+		const CharacterInfo &chi = _GP(game).chars[cc];
+		if (chi.room != _G(displayed_room) || !chi.on)
+			continue;
+		if (chi.view >= 0 && chi.view < _GP(game).numviews && chi.loop < _GP(views)[chi.view].numLoops) {
+			const ViewLoopNew &loop = _GP(views)[chi.view].loops[chi.loop];
+			for (int f = 0; f < loop.numFrames; f++)
+				_GP(spriteset).Prefetch(loop.frames[f].pic);
+		}
+	}
+}
+
 // forchar = playerchar on NewRoom, or NULL if restore saved game
 void load_new_room(int newnum, CharacterInfo *forchar) {
 
@@ -858,6 +885,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		_GP(play).UpdateRoomCameras(); // update auto tracking
 	}
 	init_room_drawdata();
+	prefetch_room_sprites();
 
 	_G(our_eip) = 212;
 	invalidate_screen();
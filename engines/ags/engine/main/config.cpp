@@ -327,6 +327,9 @@ void apply_config(const ConfigTree &cfg) {
 		int cache_size_kb = CfgReadInt(cfg, "misc", "cachemax", DEFAULTCACHESIZE_KB);
 		if (cache_size_kb > 0)
 			_GP(spriteset).SetMaxCacheSize((size_t)cache_size_kb * 1024);
+		int compressed_size_kb = CfgReadInt(cfg, "misc", "cachemax_compressed", DEFAULTCOMPRESSEDCACHESIZE_KB);
+		if (compressed_size_kb >= 0)
+			_GP(spriteset).SetMaxCompressedSize((size_t)compressed_size_kb * 1024);
 
 		_GP(usetup).mouse_auto_lock = CfgReadBoolInt(cfg, "mouse", "auto_lock");
 
@@ -804,6 +804,11 @@ void UpdateGameOnce(bool checkControls, IDriverDependantBitmap *extraBitmap, int
 	if (_G(abort_engine))
 		return;
 
+	// Compress the sprites disposed from the cache in the spare time left
+	// in this frame, with a minimum so that it still progresses when lagging
+	auto now = AGS_Clock::now();
+	_GP(spriteset).CompressPending(_G(next_frame_timestamp) > now ? MAX<uint32>(_G(next_frame_timestamp) - now, 1) : 1);
+
 	WaitForNextFrame();
 }
 
@@ -307,45 +307,25 @@ int ccInstance::CallScriptFunction(const char *funcname, int32_t numargs, const
 		return -4;
 	}
 
-	int32_t startat = -1;
-	int k;
-	char mangledName[200];
-	size_t mangled_len = snprintf(mangledName, sizeof(mangledName), "%s$", funcname);
-	int32_t export_args = 0;
-
-	for (k = 0; k < instanceof->numexports; k++) {
-		char *thisExportName = instanceof->exports[k];
-		int match = 0;
-
-		// check for a mangled name match
-		if (strncmp(thisExportName, mangledName, mangled_len) == 0) {
-			// found, compare the number of parameters
-			export_args = atoi(thisExportName + mangled_len);
-			if (export_args > numargs) {
-				cc_error("wrong number of parameters to exported function '%s' (expected %d, supplied %d)",
-					funcname, export_args, numargs);
-				return -1;
-			}
-			match = 1;
-		}
+	const ExportLookup &lookup = FindExport(funcname);
+	if (lookup.Index < 0) {
+		cc_error("function '%s' not found", funcname);
+		return -2;
+	}
 
-		// check for an exact match (if the script was compiled with
-		// an older version)
-		if ((match == 1) || (strcmp(thisExportName, funcname) == 0)) {
-			int32_t etype = (instanceof->export_addr[k] >> 24L) & 0x000ff;
-			if (etype != EXPORT_FUNCTION) {
-				cc_error("symbol is not a function");
-				return -1;
-			}
-			startat = (instanceof->export_addr[k] & 0x00ffffff);
-			break;
-		}
+	int32_t export_args = lookup.NumArgs;
+	if (lookup.Mangled && export_args > numargs) {
+		cc_error("wrong number of parameters to exported function '%s' (expected %d, supplied %d)",
+			funcname, export_args, numargs);
+		return -1;
 	}
 
-	if (startat < 0) {
-		cc_error("function '%s' not found", funcname);
-		return -2;
+	int32_t etype = (instanceof->export_addr[lookup.Index] >> 24L) & 0x000ff;
+	if (etype != EXPORT_FUNCTION) {
+		cc_error("symbol is not a function");
+		return -1;
 	}
+	int32_t startat = (instanceof->export_addr[lookup.Index] & 0x00ffffff);
 
 	// Prepare instance for run
 	flags &= ~INSTF_ABORTED;
@@ -364,7 +344,22 @@ int ccInstance::CallScriptFunction(const char *funcname, int32_t numargs, const
 
 	_GP(InstThreads).push_back(this); // push instance thread
 	runningInst = this;
+	ScriptProfile &profile = _GP(scriptProfile);
+	const bool profiling = profile.Enabled;
+	const uint32_t profileStartTime = profiling ? g_system->getMillis() : 0;
+	const uint64 profileStartCount = profile.InstructionCount;
 	int reterr = Run(startat);
+	if (profiling) {
+		const char *section = instanceof->GetSectionName(startat);
+		ScriptProfile::Entry &entry = profile.Entries[String::FromFormat("%s::%s", section, funcname)];
+		if (entry.Calls == 0) {
+			entry.Section = section;
+			entry.Function = funcname;
+		}
+		entry.Calls++;
+		entry.TimeMs += g_system->getMillis() - profileStartTime;
+		entry.Instructions += profile.InstructionCount - profileStartCount;
+	}
 	// Cleanup before returning, even if error
 	ASSERT_STACK_SIZE(numargs);
 	PopValuesFromStack(numargs);
@@ -440,6 +435,8 @@ int ccInstance::Run(int32_t curpc) {
 	ccInstance *codeInst = runningInst;
 	bool write_debug_dump = ccGetOption(SCOPT_DEBUGRUN) ||
 		(gDebugLevel > 0 && DebugMan.isDebugChannelEnabled(::AGS::kDebugScript));
+	ScriptProfile &profile = _GP(scriptProfile);
+	const bool profiling = profile.Enabled;
 	ScriptOperation codeOp;
 
 	FunctionCallStack func_callstack;
@@ -541,6 +538,8 @@ int ccInstance::Run(int32_t curpc) {
 		if (write_debug_dump) {
 			DumpInstruction(codeOp);
 		}
+		if (profiling)
+			profile.InstructionCount++;
 
 		switch (codeOp.Instruction.Code) {
 		case SCMD_LINENUM:
@@ -1247,19 +1246,36 @@ void ccInstance::GetScriptPosition(ScriptPosition &script_pos) const {
 
 // get a pointer to a variable or function exported by the script
 RuntimeScriptValue ccInstance::GetSymbolAddress(const char *symname) const {
-	int k;
-	char altName[200];
-	snprintf(altName, sizeof(altName), "%s$", symname);
-	RuntimeScriptValue rval_null;
-
-	for (k = 0; k < instanceof->numexports; k++) {
-		if (strcmp(instanceof->exports[k], symname) == 0)
-			return exports[k];
-		// mangled function name
-		if (strncmp(instanceof->exports[k], altName, strlen(altName)) == 0)
-			return exports[k];
+	const ExportLookup &lookup = FindExport(symname);
+	if (lookup.Index < 0)
+		return RuntimeScriptValue();
+	return exports[lookup.Index];
+}
+
+const ccInstance::ExportLookup &ccInstance::FindExport(const char *symname) const {
+	std::unordered_map<String, ExportLookup>::iterator it = export_lookup.find(symname);
+	if (it != export_lookup.end())
+		return it->_value;
+
+	// Exported functions may have their number of arguments appended
+	// to their name, as in "name$2"
+	char mangledName[200];
+	size_t mangled_len = snprintf(mangledName, sizeof(mangledName), "%s$", symname);
+	ExportLookup lookup;
+	for (int k = 0; k < instanceof->numexports; k++) {
+		const char *thisExportName = instanceof->exports[k];
+		if (strncmp(thisExportName, mangledName, mangled_len) == 0) {
+			lookup.Index = k;
+			lookup.Mangled = true;
+			lookup.NumArgs = atoi(thisExportName + mangled_len);
+			break;
+		}
+		if (strcmp(thisExportName, symname) == 0) {
+			lookup.Index = k;
+			break;
+		}
 	}
-	return rval_null;
+	return export_lookup[symname] = lookup;
 }
 
 void ccInstance::DumpInstruction(const ScriptOperation &op) const {
@@ -28,6 +28,7 @@
 #include "ags/shared/script/cc_script.h"  // ccScript
 #include "ags/engine/script/non_blocking_script_function.h"
 #include "ags/shared/util/string.h"
+#include "ags/shared/util/string_types.h"
 
 namespace AGS3 {
 
@@ -80,6 +81,27 @@ struct ScriptVariable {
 
 struct FunctionCallStack;
 
+// Time and instructions spent in the script functions called by the engine;
+// nested script calls are included in the totals of their callers
+struct ScriptProfile {
+	struct Entry {
+		Entry() : Calls(0), TimeMs(0), Instructions(0) {}
+
+		Shared::String  Section;
+		Shared::String  Function;
+		uint32_t        Calls;
+		uint32_t        TimeMs;
+		uint64          Instructions;
+	};
+
+	ScriptProfile() : Enabled(false), InstructionCount(0) {}
+
+	bool Enabled;
+	// Running count of the executed instructions, only updated when enabled
+	uint64 InstructionCount;
+	std::unordered_map<Shared::String, Entry> Entries;
+};
+
 struct ScriptPosition {
 	ScriptPosition()
 		: Line(0) {
@@ -177,6 +199,20 @@ public:
 	bool    ResolveImportFixups(const ccScript *scri);
 
 protected:
+	// Result of looking up an exported symbol by name
+	struct ExportLookup {
+		ExportLookup() : Index(-1), Mangled(false), NumArgs(0) {}
+
+		int32_t Index;      // index in the exports, -1 if not found
+		bool    Mangled;    // matched as "name$numargs"
+		int32_t NumArgs;    // declared number of arguments of a mangled function
+	};
+	// Lookups are cached per name, as the engine calls the same script
+	// callbacks and checks for the same symbols every game loop
+	mutable std::unordered_map<Shared::String, ExportLookup> export_lookup;
+
+	const ExportLookup &FindExport(const char *symname) const;
+
 	bool    _Create(PScript scri, ccInstance *joined);
 	// free the memory associated with the instance
 	void    Free();
@@ -131,6 +131,7 @@ Globals::Globals() {
 	// cc_instance.cpp globals
 	_InstThreads = new std::deque<ccInstance *>();
 	_GlobalReturnValue = new RuntimeScriptValue();
+	_scriptProfile = new ScriptProfile();
 
 	// cc_options.cpp globals
 	_ccCompOptions = SCOPT_LEFTTORIGHT;
@@ -409,6 +410,7 @@ Globals::~Globals() {
 	delete _InstThreads;
 	delete _GlobalReturnValue;
 	delete _scriptDumpFile;
+	delete _scriptProfile;
 
 	// cc_serializer.cpp globals
 	delete _ccUnserializer;
@@ -163,6 +163,7 @@ struct ScriptDialog;
 struct ScriptDialogOptionsRendering;
 struct ScriptDrawingSurface;
 struct ScriptError;
+struct ScriptProfile;
 struct ScriptGUI;
 struct ScriptHotspot;
 struct ScriptInvItem;
@@ -376,6 +377,8 @@ public:
 	// Of 2012-12-20: now used only for plugin exports
 	RuntimeScriptValue *_GlobalReturnValue;
 	Common::DumpFile *_scriptDumpFile = nullptr;
+	// Statistics of the script functions run by the engine, for the console
+	ScriptProfile *_scriptProfile;
 
 	/**@}*/
 
@@ -22,6 +22,7 @@
 #include "ags/lib/allegro/gfx.h"
 #include "ags/lib/allegro/color.h"
 #include "ags/lib/allegro/flood.h"
+#include "ags/lib/allegro/surface_blend.h"
 #include "ags/ags.h"
 #include "ags/globals.h"
 #include "common/textconsole.h"
@@ -107,6 +108,27 @@ void BITMAP::floodfill(int x, int y, int color) {
 const int SCALE_THRESHOLD = 0x100;
 #define VGA_COLOR_TRANS(x) ((x) * 255 / 63)
 
+/**
+ * Returns the row blender to use for blending src onto dest with the
+ * current blender mode, or nullptr if the pixels have to be blended one by
+ * one. Row blenders only handle 32-bit ARGB, and can't be used when the
+ * source and destination pixels overlap.
+ */
+static BlendRowProc getRowBlender(const Graphics::ManagedSurface &src, const Graphics::ManagedSurface &dest, int srcAlpha) {
+	static const Graphics::PixelFormat argbFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
+	if (srcAlpha == -1 || src.format != argbFormat || dest.format != argbFormat)
+		return nullptr;
+
+	const byte *srcStart = (const byte *)src.getPixels();
+	const byte *srcEnd = srcStart + src.pitch * src.h;
+	const byte *destStart = (const byte *)dest.getPixels();
+	const byte *destEnd = destStart + dest.pitch * dest.h;
+	if (srcStart < destEnd && destStart < srcEnd)
+		return nullptr;
+
+	return getBlendRowProc(_G(_blender_mode));
+}
+
 void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
                   int dstX, int dstY, bool horizFlip, bool vertFlip,
                   bool skipTrans, int srcAlpha, int tintRed, int tintGreen,
@@ -166,6 +188,14 @@ void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 	int xStart = (dstRect.left < destRect.left) ? dstRect.left - destRect.left : 0;
 	int yStart = (dstRect.top < destRect.top) ? dstRect.top - destRect.top : 0;
 
+	// The visible part of each row, for the row blender
+	BlendRowProc blendRow = useTint ? nullptr : getRowBlender(src, dest, srcAlpha);
+	int xBegin = -xStart;
+	int xEnd = MIN<int>(dstRect.width(), destArea.w - xStart);
+	Common::Array<uint32> rowBuffer;
+	if (blendRow && horizFlip)
+		rowBuffer.resize(dstRect.width());
+
 	for (int destY = yStart, yCtr = 0; yCtr < dstRect.height(); ++destY, ++yCtr) {
 		if (destY < 0 || destY >= destArea.h)
 			continue;
@@ -175,6 +205,19 @@ void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 		                       vertFlip ? srcArea.bottom - 1 - yCtr :
 		                       srcArea.top + yCtr);
 
+		if (blendRow) {
+			if (xBegin >= xEnd)
+				continue;
+			const uint32 *srcRow = (const uint32 *)srcP + xBegin;
+			if (horizFlip) {
+				for (int xCtr = xBegin; xCtr < xEnd; ++xCtr)
+					rowBuffer[xCtr - xBegin] = *((const uint32 *)srcP - xCtr);
+				srcRow = &rowBuffer[0];
+			}
+			blendRow((uint32 *)destP, srcRow, xEnd - xBegin, srcAlpha, skipTrans);
+			continue;
+		}
+
 		// Loop through the pixels of the row
 		for (int destX = xStart, xCtr = 0, xCtrBpp = 0; xCtr < dstRect.width(); ++destX, ++xCtr, xCtrBpp += src.format.bytesPerPixel) {
 			if (destX < 0 || destX >= destArea.w)
@@ -293,6 +336,14 @@ void BITMAP::stretchDraw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 	int xStart = (dstRect.left < destRect.left) ? dstRect.left - destRect.left : 0;
 	int yStart = (dstRect.top < destRect.top) ? dstRect.top - destRect.top : 0;
 
+	// The visible part of each row, for the row blender
+	BlendRowProc blendRow = getRowBlender(src, dest, srcAlpha);
+	int xBegin = -xStart;
+	int xEnd = MIN<int>(dstRect.width(), destArea.w - xStart);
+	Common::Array<uint32> rowBuffer;
+	if (blendRow)
+		rowBuffer.resize(dstRect.width());
+
 	for (int destY = yStart, yCtr = 0, scaleYCtr = 0; yCtr < dstRect.height();
 	        ++destY, ++yCtr, scaleYCtr += scaleY) {
 		if (destY < 0 || destY >= destArea.h)
@@ -301,6 +352,16 @@ void BITMAP::stretchDraw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 		const byte *srcP = (const byte *)src.getBasePtr(
 		                       srcRect.left, srcRect.top + scaleYCtr / SCALE_THRESHOLD);
 
+		if (blendRow) {
+			if (xBegin >= xEnd)
+				continue;
+			// Gather the scaled source pixels, then blend them as one row
+			for (int xCtr = xBegin; xCtr < xEnd; ++xCtr)
+				rowBuffer[xCtr - xBegin] = *((const uint32 *)srcP + xCtr * scaleX / SCALE_THRESHOLD);
+			blendRow((uint32 *)destP, &rowBuffer[0], xEnd - xBegin, srcAlpha, skipTrans);
+			continue;
+		}
+
 		// Loop through the pixels of the row
 		for (int destX = xStart, xCtr = 0, scaleXCtr = 0; xCtr < dstRect.width();
 		        ++destX, ++xCtr, scaleXCtr += scaleX) {
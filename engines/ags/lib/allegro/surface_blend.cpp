@@ -0,0 +1,305 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ags/lib/allegro/surface_blend.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace AGS3 {
+
+namespace {
+
+// Allegro uses 255, 0, 255 RGB as the transparent color
+const uint32 kTransColor = 0xFF00FF;
+const uint32 kRgbMask = 0xFFFFFF;
+
+// Same arithmetic as BITMAP::rgbBlend, including its wrap arounds, on
+// packed pixels
+inline uint32 rgbBlend(uint32 x, uint32 y, uint32 alpha) {
+	if (alpha)
+		alpha++;
+
+	x &= kRgbMask;
+	y &= kRgbMask;
+	uint32 res = ((x & 0xFF00FF) - (y & 0xFF00FF)) * alpha / 256 + y;
+	uint32 g = ((x & 0xFF00) - (y & 0xFF00)) * alpha / 256 + (y & 0xFF00);
+	return (res & 0xFF00FF) | (g & 0xFF00);
+}
+
+template<BlenderMode mode>
+inline uint32 blendPixel(uint32 src, uint32 dest, uint32 alpha);
+
+template<>
+inline uint32 blendPixel<kRgbToRgbBlender>(uint32 src, uint32 dest, uint32 alpha) {
+	return rgbBlend(src, dest, alpha);
+}
+
+template<>
+inline uint32 blendPixel<kAlphaPreservedBlenderMode>(uint32 src, uint32 dest, uint32 alpha) {
+	return rgbBlend(src, dest, alpha) | (dest & 0xFF000000);
+}
+
+template<>
+inline uint32 blendPixel<kSourceAlphaBlender>(uint32 src, uint32 dest, uint32 alpha) {
+	return rgbBlend(src, dest, src >> 24);
+}
+
+template<>
+inline uint32 blendPixel<kArgbToRgbBlender>(uint32 src, uint32 dest, uint32 alpha) {
+	uint32 aSrc = src >> 24;
+	if (alpha != 0)
+		aSrc = aSrc * ((alpha & 0xff) + 1) / 256;
+	return rgbBlend(src, dest, aSrc);
+}
+
+template<>
+inline uint32 blendPixel<kOpaqueBlenderMode>(uint32 src, uint32 dest, uint32 alpha) {
+	return (src & kRgbMask) | 0xFF000000;
+}
+
+template<>
+inline uint32 blendPixel<kAdditiveBlenderMode>(uint32 src, uint32 dest, uint32 alpha) {
+	uint32 a = (src >> 24) + (dest >> 24);
+	return (src & kRgbMask) | (MIN<uint32>(a, 0xff) << 24);
+}
+
+template<BlenderMode mode>
+void blendRowScalar(uint32 *dest, const uint32 *src, int count, uint32 alpha, bool skipTrans) {
+	for (int i = 0; i < count; ++i) {
+		if (skipTrans && (src[i] & kRgbMask) == kTransColor)
+			continue;
+		dest[i] = blendPixel<mode>(src[i], dest[i], alpha);
+	}
+}
+
+#if defined(__SSE2__)
+
+// SSE2 has no 32-bit low multiply, so combine two 32x32->64 multiplies
+inline __m128i mullo32(__m128i a, __m128i b) {
+	__m128i even = _mm_mul_epu32(a, b);
+	__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                          _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// The "if (alpha) alpha++" of rgbBlend
+inline __m128i incrementNonZero(__m128i a) {
+	return _mm_add_epi32(_mm_add_epi32(a, _mm_set1_epi32(1)), _mm_cmpeq_epi32(a, _mm_setzero_si128()));
+}
+
+// rgbBlend for four pixels, with the alphas already incremented
+inline __m128i rgbBlend4(__m128i x, __m128i y, __m128i alpha) {
+	const __m128i rgbMask = _mm_set1_epi32(kRgbMask);
+	const __m128i rbMask = _mm_set1_epi32(0xFF00FF);
+	const __m128i gMask = _mm_set1_epi32(0xFF00);
+
+	x = _mm_and_si128(x, rgbMask);
+	y = _mm_and_si128(y, rgbMask);
+	__m128i yG = _mm_and_si128(y, gMask);
+	__m128i res = _mm_sub_epi32(_mm_and_si128(x, rbMask), _mm_and_si128(y, rbMask));
+	res = _mm_add_epi32(_mm_srli_epi32(mullo32(res, alpha), 8), y);
+	__m128i g = _mm_sub_epi32(_mm_and_si128(x, gMask), yG);
+	g = _mm_add_epi32(_mm_srli_epi32(mullo32(g, alpha), 8), yG);
+	return _mm_or_si128(_mm_and_si128(res, rbMask), _mm_and_si128(g, gMask));
+}
+
+template<BlenderMode mode>
+inline __m128i blendPixels(__m128i src, __m128i dest, uint32 alpha) {
+	const __m128i rgbMask = _mm_set1_epi32(kRgbMask);
+	const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+
+	switch (mode) {
+	case kRgbToRgbBlender:
+		return rgbBlend4(src, dest, _mm_set1_epi32(alpha ? alpha + 1 : 0));
+	case kAlphaPreservedBlenderMode:
+		return _mm_or_si128(rgbBlend4(src, dest, _mm_set1_epi32(alpha ? alpha + 1 : 0)),
+		                    _mm_and_si128(dest, alphaMask));
+	case kSourceAlphaBlender:
+		return rgbBlend4(src, dest, incrementNonZero(_mm_srli_epi32(src, 24)));
+	case kArgbToRgbBlender: {
+		__m128i aSrc = _mm_srli_epi32(src, 24);
+		if (alpha != 0)
+			aSrc = _mm_srli_epi32(mullo32(aSrc, _mm_set1_epi32((alpha & 0xff) + 1)), 8);
+		return rgbBlend4(src, dest, incrementNonZero(aSrc));
+	}
+	case kOpaqueBlenderMode:
+		return _mm_or_si128(_mm_and_si128(src, rgbMask), alphaMask);
+	case kAdditiveBlenderMode: {
+		const __m128i maxAlpha = _mm_set1_epi32(0xff);
+		__m128i a = _mm_add_epi32(_mm_srli_epi32(src, 24), _mm_srli_epi32(dest, 24));
+		__m128i over = _mm_cmpgt_epi32(a, maxAlpha);
+		a = _mm_or_si128(_mm_and_si128(over, maxAlpha), _mm_andnot_si128(over, a));
+		return _mm_or_si128(_mm_and_si128(src, rgbMask), _mm_slli_epi32(a, 24));
+	}
+	default:
+		return dest;
+	}
+}
+
+template<BlenderMode mode>
+void blendRowVector(uint32 *dest, const uint32 *src, int count, uint32 alpha, bool skipTrans) {
+	const __m128i rgbMask = _mm_set1_epi32(kRgbMask);
+	const __m128i transColor = _mm_set1_epi32(kTransColor);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+		__m128i result = blendPixels<mode>(s, d, alpha);
+		if (skipTrans) {
+			__m128i trans = _mm_cmpeq_epi32(_mm_and_si128(s, rgbMask), transColor);
+			result = _mm_or_si128(_mm_and_si128(trans, d), _mm_andnot_si128(trans, result));
+		}
+		_mm_storeu_si128((__m128i *)(dest + i), result);
+	}
+
+	blendRowScalar<mode>(dest + i, src + i, count - i, alpha, skipTrans);
+}
+
+#define HAVE_BLEND_ROW_VECTOR
+
+#elif defined(__ARM_NEON)
+
+// The "if (alpha) alpha++" of rgbBlend
+inline uint32x4_t incrementNonZero(uint32x4_t a) {
+	return vaddq_u32(a, vminq_u32(a, vdupq_n_u32(1)));
+}
+
+// rgbBlend for four pixels, with the alphas already incremented
+inline uint32x4_t rgbBlend4(uint32x4_t x, uint32x4_t y, uint32x4_t alpha) {
+	const uint32x4_t rgbMask = vdupq_n_u32(kRgbMask);
+	const uint32x4_t rbMask = vdupq_n_u32(0xFF00FF);
+	const uint32x4_t gMask = vdupq_n_u32(0xFF00);
+
+	x = vandq_u32(x, rgbMask);
+	y = vandq_u32(y, rgbMask);
+	uint32x4_t yG = vandq_u32(y, gMask);
+	uint32x4_t res = vsubq_u32(vandq_u32(x, rbMask), vandq_u32(y, rbMask));
+	res = vaddq_u32(vshrq_n_u32(vmulq_u32(res, alpha), 8), y);
+	uint32x4_t g = vsubq_u32(vandq_u32(x, gMask), yG);
+	g = vaddq_u32(vshrq_n_u32(vmulq_u32(g, alpha), 8), yG);
+	return vorrq_u32(vandq_u32(res, rbMask), vandq_u32(g, gMask));
+}
+
+template<BlenderMode mode>
+inline uint32x4_t blendPixels(uint32x4_t src, uint32x4_t dest, uint32 alpha) {
+	const uint32x4_t rgbMask = vdupq_n_u32(kRgbMask);
+	const uint32x4_t alphaMask = vdupq_n_u32(0xFF000000);
+
+	switch (mode) {
+	case kRgbToRgbBlender:
+		return rgbBlend4(src, dest, vdupq_n_u32(alpha ? alpha + 1 : 0));
+	case kAlphaPreservedBlenderMode:
+		return vorrq_u32(rgbBlend4(src, dest, vdupq_n_u32(alpha ? alpha + 1 : 0)),
+		                 vandq_u32(dest, alphaMask));
+	case kSourceAlphaBlender:
+		return rgbBlend4(src, dest, incrementNonZero(vshrq_n_u32(src, 24)));
+	case kArgbToRgbBlender: {
+		uint32x4_t aSrc = vshrq_n_u32(src, 24);
+		if (alpha != 0)
+			aSrc = vshrq_n_u32(vmulq_n_u32(aSrc, (alpha & 0xff) + 1), 8);
+		return rgbBlend4(src, dest, incrementNonZero(aSrc));
+	}
+	case kOpaqueBlenderMode:
+		return vorrq_u32(vandq_u32(src, rgbMask), alphaMask);
+	case kAdditiveBlenderMode: {
+		uint32x4_t a = vaddq_u32(vshrq_n_u32(src, 24), vshrq_n_u32(dest, 24));
+		a = vminq_u32(a, vdupq_n_u32(0xff));
+		return vorrq_u32(vandq_u32(src, rgbMask), vshlq_n_u32(a, 24));
+	}
+	default:
+		return dest;
+	}
+}
+
+template<BlenderMode mode>
+void blendRowVector(uint32 *dest, const uint32 *src, int count, uint32 alpha, bool skipTrans) {
+	const uint32x4_t rgbMask = vdupq_n_u32(kRgbMask);
+	const uint32x4_t transColor = vdupq_n_u32(kTransColor);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		uint32x4_t s = vld1q_u32(src + i);
+		uint32x4_t d = vld1q_u32(dest + i);
+		uint32x4_t result = blendPixels<mode>(s, d, alpha);
+		if (skipTrans)
+			result = vbslq_u32(vceqq_u32(vandq_u32(s, rgbMask), transColor), d, result);
+		vst1q_u32(dest + i, result);
+	}
+
+	blendRowScalar<mode>(dest + i, src + i, count - i, alpha, skipTrans);
+}
+
+#define HAVE_BLEND_ROW_VECTOR
+
+#endif
+
+} // End of anonymous namespace
+
+BlendRowProc getBlendRowProc(BlenderMode mode) {
+#ifdef HAVE_BLEND_ROW_VECTOR
+	switch (mode) {
+	case kSourceAlphaBlender:
+		return blendRowVector<kSourceAlphaBlender>;
+	case kArgbToRgbBlender:
+		return blendRowVector<kArgbToRgbBlender>;
+	case kRgbToRgbBlender:
+		return blendRowVector<kRgbToRgbBlender>;
+	case kAlphaPreservedBlenderMode:
+		return blendRowVector<kAlphaPreservedBlenderMode>;
+	case kOpaqueBlenderMode:
+		return blendRowVector<kOpaqueBlenderMode>;
+	case kAdditiveBlenderMode:
+		return blendRowVector<kAdditiveBlenderMode>;
+	default:
+		return nullptr;
+	}
+#else
+	return getBlendRowProcScalar(mode);
+#endif
+}
+
+BlendRowProc getBlendRowProcScalar(BlenderMode mode) {
+	// The ARGB to ARGB modes blend in floating point, and the tint modes go
+	// through HSV, so they are left to BITMAP::blendPixel
+	switch (mode) {
+	case kSourceAlphaBlender:
+		return blendRowScalar<kSourceAlphaBlender>;
+	case kArgbToRgbBlender:
+		return blendRowScalar<kArgbToRgbBlender>;
+	case kRgbToRgbBlender:
+		return blendRowScalar<kRgbToRgbBlender>;
+	case kAlphaPreservedBlenderMode:
+		return blendRowScalar<kAlphaPreservedBlenderMode>;
+	case kOpaqueBlenderMode:
+		return blendRowScalar<kOpaqueBlenderMode>;
+	case kAdditiveBlenderMode:
+		return blendRowScalar<kAdditiveBlenderMode>;
+	default:
+		return nullptr;
+	}
+}
+
+} // namespace AGS3
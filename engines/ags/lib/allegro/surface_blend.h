@@ -0,0 +1,57 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AGS_LIB_ALLEGRO_SURFACE_BLEND_H
+#define AGS_LIB_ALLEGRO_SURFACE_BLEND_H
+
+#include "common/scummsys.h"
+#include "ags/lib/allegro/color.h"
+
+namespace AGS3 {
+
+/**
+ * Blends a row of 32-bit ARGB source pixels onto a row of destination pixels
+ * of the same format, giving the same result as BITMAP::draw blending the
+ * pixels one by one.
+ * @param dest		Destination pixels
+ * @param src		Source pixels
+ * @param count		Number of pixels
+ * @param alpha		The srcAlpha value passed to BITMAP::draw
+ * @param skipTrans	Leave destination pixels under transparent (magenta)
+ *					source pixels untouched
+ */
+typedef void (*BlendRowProc)(uint32 *dest, const uint32 *src, int count, uint32 alpha, bool skipTrans);
+
+/**
+ * Returns the fastest row blender for the given mode, or nullptr if the mode
+ * has no row blender and has to be blended pixel by pixel.
+ */
+BlendRowProc getBlendRowProc(BlenderMode mode);
+
+/**
+ * Returns the plain C++ row blender for the given mode, or nullptr if the
+ * mode has no row blender. Used to check the vectorized blenders.
+ */
+BlendRowProc getBlendRowProcScalar(BlenderMode mode);
+
+} // namespace AGS3
+
+#endif
@@ -27,6 +27,8 @@
 
 #include "common/system.h"
 #include "ags/shared/util/stream.h"
+#include "ags/shared/util/compress.h"
+#include "ags/shared/util/memory_stream.h"
 #include "ags/lib/std/algorithm.h"
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/ac/common.h" // quit
@@ -96,10 +98,45 @@ void SpriteCache::SetMaxCacheSize(size_t size) {
 	_maxCacheSize = size;
 }
 
+size_t SpriteCache::GetCompressedSize() const {
+	return _compressedSize;
+}
+
+size_t SpriteCache::GetMaxCompressedSize() const {
+	return _maxCompressedSize;
+}
+
+void SpriteCache::SetMaxCompressedSize(size_t size) {
+	_maxCompressedSize = size;
+	while (_compressedSize > _maxCompressedSize)
+		RemoveCompressed(_compressedOrder.front());
+	if (_maxCompressedSize == 0) {
+		while (!_pendingOrder.empty())
+			RemovePending(_pendingOrder.front());
+	}
+}
+
+size_t SpriteCache::GetPendingCompressSize() const {
+	return _pendingSize;
+}
+
+void SpriteCache::CompressPending(uint32_t time_budget_ms) {
+	const uint32_t start = g_system->getMillis();
+	while (!_pendingOrder.empty() && g_system->getMillis() - start < time_budget_ms) {
+		const sprkey_t index = _pendingOrder.front();
+		const PendingSprite &entry = _pending[index];
+		StoreCompressed(index, entry.Image);
+		RemovePending(index);
+	}
+}
+
 void SpriteCache::Init() {
 	_cacheSize = 0;
 	_lockedSize = 0;
 	_maxCacheSize = (size_t)DEFAULTCACHESIZE_KB * 1024;
+	_compressedSize = 0;
+	_maxCompressedSize = (size_t)DEFAULTCOMPRESSEDCACHESIZE_KB * 1024;
+	_pendingSize = 0;
 	_liststart = -1;
 	_listend = -1;
 }
@@ -117,6 +154,7 @@ void SpriteCache::Reset() {
 
 	_mrulist.clear();
 	_mrubacklink.clear();
+	RemoveAllCompressed();
 
 	Init();
 }
@@ -130,6 +168,7 @@ void SpriteCache::SetSprite(sprkey_t index, Bitmap *sprite) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Error, "SetSprite: attempt to assign nullptr to index %d", index);
 		return;
 	}
+	RemoveCompressed(index);
 	_spriteData[index].Image = sprite;
 	_spriteData[index].Flags = SPRCACHEFLAG_LOCKED; // NOT from asset file
 	_spriteData[index].Size = 0;
@@ -153,6 +192,7 @@ void SpriteCache::SubstituteBitmap(sprkey_t index, Bitmap *sprite) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Error, "SubstituteBitmap: attempt to set for non-existing sprite %d", index);
 		return;
 	}
+	RemoveCompressed(index);
 	_spriteData[index].Image = sprite;
 #ifdef DEBUG_SPRITECACHE
 	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "SubstituteBitmap: %d", index);
@@ -162,6 +202,7 @@ void SpriteCache::SubstituteBitmap(sprkey_t index, Bitmap *sprite) {
 void SpriteCache::RemoveSprite(sprkey_t index, bool freeMemory) {
 	if (freeMemory)
 		delete _spriteData[index].Image;
+	RemoveCompressed(index);
 	InitNullSpriteParams(index);
 #ifdef DEBUG_SPRITECACHE
 	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "RemoveSprite: %d", index);
@@ -228,13 +269,39 @@ Bitmap *SpriteCache::operator [] (sprkey_t index) {
 		return _spriteData[index].Image;
 
 	// Sprite exists in file but is not in mem, load it
-	if ((_spriteData[index].Image == nullptr) && _spriteData[index].IsAssetSprite())
+	bool loaded = false;
+	if ((_spriteData[index].Image == nullptr) && _spriteData[index].IsAssetSprite()) {
 		LoadSprite(index);
+		loaded = true;
+	}
 
 	// Locked sprite that shouldn't be put into MRU list
 	if (_spriteData[index].IsLocked())
 		return _spriteData[index].Image;
 
+	if (!loaded)
+		_stats.Hits++;
+	TouchMRU(index);
+	return _spriteData[index].Image;
+}
+
+void SpriteCache::Prefetch(sprkey_t index) {
+	if (index < 0 || (size_t)index >= _spriteData.size())
+		return;
+	if ((_spriteData[index].Image != nullptr) || !_spriteData[index].IsAssetSprite() ||
+		(_spriteData[index].Flags & SPRCACHEFLAG_REMAPPED) != 0)
+		return;
+	// Don't let prefetched sprites push out the ones that are already in use
+	if (_cacheSize >= _maxCacheSize)
+		return;
+
+	LoadSprite(index, true);
+	_stats.Prefetches++;
+	if (!_spriteData[index].IsLocked())
+		TouchMRU(index);
+}
+
+void SpriteCache::TouchMRU(sprkey_t index) {
 	if (_liststart < 0) {
 		_liststart = index;
 		_listend = index;
@@ -258,8 +325,6 @@ Bitmap *SpriteCache::operator [] (sprkey_t index) {
 		_mrubacklink[index] = _listend;
 		_listend = index;
 	}
-
-	return _spriteData[index].Image;
 }
 
 void SpriteCache::DisposeOldest() {
@@ -277,7 +342,7 @@ void SpriteCache::DisposeOldest() {
 		}
 		_cacheSize -= _spriteData[sprnum].Size;
 
-		delete _spriteData[sprnum].Image;
+		QueueCompressed(sprnum);
 		_spriteData[sprnum].Image = nullptr;
 	}
 
@@ -353,7 +418,7 @@ sprkey_t SpriteCache::GetDataIndex(sprkey_t index) {
 	return (_spriteData[index].Flags & SPRCACHEFLAG_REMAPPED) == 0 ? index : 0;
 }
 
-size_t SpriteCache::LoadSprite(sprkey_t index) {
+size_t SpriteCache::LoadSprite(sprkey_t index, bool prefetch) {
 	int hh = 0;
 
 	while (_cacheSize > _maxCacheSize) {
@@ -368,8 +433,19 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 	if (index < 0 || (size_t)index >= _spriteData.size())
 		quit("sprite cache array index out of bounds");
 
+	// Sprite was disposed recently, and has kept a compressed copy
+	Bitmap *image = RestoreCompressed(index);
+	if (image) {
+		_spriteData[index].Image = image;
+		size_t size = _sprInfos[index].Width * _sprInfos[index].Height * image->GetBPP();
+		_spriteData[index].Size = size;
+		_cacheSize += size;
+		if (!prefetch)
+			_stats.Restores++;
+		return size;
+	}
+
 	sprkey_t load_index = GetDataIndex(index);
-	Bitmap *image;
 	HError err = _file.LoadSprite(load_index, image);
 	if (!image) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Warn,
@@ -403,6 +479,8 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 		_spriteData[index].Image->GetBPP();
 	_spriteData[index].Size = size;
 	_cacheSize += size;
+	if (!prefetch)
+		_stats.Loads++;
 
 #ifdef DEBUG_SPRITECACHE
 	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "Loaded %d, size now %zu KB", index, _cacheSize / 1024);
@@ -411,7 +489,120 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 	return size;
 }
 
+void SpriteCache::QueueCompressed(sprkey_t index) {
+	Bitmap *image = _spriteData[index].Image;
+	const size_t raw_size = _spriteData[index].Size;
+	// The restored sprite must match the one that was loaded, so the copy
+	// is only kept if the image was not resized by the engine meanwhile
+	if (_maxCompressedSize == 0 || raw_size == 0 ||
+		(image->GetBPP() != 1 && image->GetBPP() != 2 && image->GetBPP() != 4) || // not supported by the RLE packer
+		image->GetWidth() != _sprInfos[index].Width || image->GetHeight() != _sprInfos[index].Height) {
+		delete image;
+		return;
+	}
+
+	RemoveCompressed(index);
+	PendingSprite &entry = _pending[index];
+	entry.Image = image;
+	entry.Size = raw_size;
+	entry.Order = _pendingOrder.insert(_pendingOrder.end(), index);
+	_pendingSize += raw_size;
+
+	// Sprites which could not be compressed in time are dropped entirely
+	while (_pendingSize > (size_t)PENDINGCOMPRESSSIZE_KB * 1024)
+		RemovePending(_pendingOrder.front());
+}
+
+void SpriteCache::StoreCompressed(sprkey_t index, const Bitmap *image) {
+	const size_t raw_size = image->GetWidth() * image->GetHeight() * image->GetBPP();
+	CompressedSprite &entry = _compressed[index];
+	{
+		VectorStream out(entry.Data, kStream_Write);
+		const size_t line_size = image->GetWidth() * image->GetBPP();
+		for (int y = 0; y < image->GetHeight(); ++y)
+			rle_compress(image->GetScanLine(y), line_size, image->GetBPP(), &out);
+	}
+	// Not worth keeping if the sprite does not compress well
+	if (entry.Data.size() >= raw_size / 2 || entry.Data.size() > _maxCompressedSize) {
+		_compressed.erase(index);
+		return;
+	}
+	entry.ColorDepth = image->GetColorDepth();
+	entry.Order = _compressedOrder.insert(_compressedOrder.end(), index);
+	_compressedSize += entry.Data.size();
+
+	while (_compressedSize > _maxCompressedSize)
+		RemoveCompressed(_compressedOrder.front());
+}
+
+Bitmap *SpriteCache::RestoreCompressed(sprkey_t index) {
+	if (!_pending.empty()) {
+		std::unordered_map<sprkey_t, PendingSprite>::iterator pit = _pending.find(index);
+		if (pit != _pending.end()) {
+			// Not compressed yet, so the image is simply handed back
+			Bitmap *image = pit->_value.Image;
+			_pendingSize -= pit->_value.Size;
+			_pendingOrder.erase(pit->_value.Order);
+			_pending.erase(pit);
+			return image;
+		}
+	}
+	if (_compressed.empty())
+		return nullptr;
+	std::unordered_map<sprkey_t, CompressedSprite>::iterator it = _compressed.find(index);
+	if (it == _compressed.end())
+		return nullptr;
+
+	const CompressedSprite &entry = it->_value;
+	Bitmap *image = BitmapHelper::CreateBitmap(_sprInfos[index].Width, _sprInfos[index].Height, entry.ColorDepth);
+	if (image) {
+		VectorStream in(entry.Data);
+		const size_t line_size = image->GetWidth() * image->GetBPP();
+		for (int y = 0; y < image->GetHeight(); ++y)
+			rle_decompress(image->GetScanLineForWriting(y), line_size, image->GetBPP(), &in);
+	}
+	// The sprite is back in the cache, its copy will be made again if it gets disposed
+	RemoveCompressed(index);
+	return image;
+}
+
+void SpriteCache::RemoveCompressed(sprkey_t index) {
+	RemovePending(index);
+	if (_compressed.empty())
+		return;
+	std::unordered_map<sprkey_t, CompressedSprite>::iterator it = _compressed.find(index);
+	if (it == _compressed.end())
+		return;
+	_compressedSize -= it->_value.Data.size();
+	_compressedOrder.erase(it->_value.Order);
+	_compressed.erase(it);
+}
+
+void SpriteCache::RemovePending(sprkey_t index) {
+	if (_pending.empty())
+		return;
+	std::unordered_map<sprkey_t, PendingSprite>::iterator it = _pending.find(index);
+	if (it == _pending.end())
+		return;
+	delete it->_value.Image;
+	_pendingSize -= it->_value.Size;
+	_pendingOrder.erase(it->_value.Order);
+	_pending.erase(it);
+}
+
+void SpriteCache::RemoveAllCompressed() {
+	for (std::unordered_map<sprkey_t, PendingSprite>::iterator it = _pending.begin(); it != _pending.end(); ++it)
+		delete it->_value.Image;
+	_pending.clear();
+	_pendingOrder.clear();
+	_pendingSize = 0;
+	_compressed.clear();
+	_compressedOrder.clear();
+	_compressedSize = 0;
+}
+
 void SpriteCache::RemapSpriteToSprite0(sprkey_t index) {
+	RemoveCompressed(index);
 	_sprInfos[index].Flags = _sprInfos[0].Flags;
 	_sprInfos[index].Width = _sprInfos[0].Width;
 	_sprInfos[index].Height = _sprInfos[0].Height;
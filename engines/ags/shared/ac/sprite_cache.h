@@ -41,6 +41,8 @@
 #ifndef AGS_SHARED_AC_SPRITE_CACHE_H
 #define AGS_SHARED_AC_SPRITE_CACHE_H
 
+#include "ags/lib/std/list.h"
+#include "ags/lib/std/map.h"
 #include "ags/lib/std/memory.h"
 #include "ags/lib/std/vector.h"
 #include "ags/shared/ac/sprite_file.h"
@@ -77,6 +79,20 @@ struct SpriteInfo;
 #define DEFAULTCACHESIZE_KB (128 * 1024)
 #endif
 
+// Max size of the compressed copies of the sprites removed from the cache, in bytes
+#if AGS_PLATFORM_OS_ANDROID || AGS_PLATFORM_OS_IOS
+#define DEFAULTCOMPRESSEDCACHESIZE_KB (8 * 1024)
+#else
+#define DEFAULTCOMPRESSEDCACHESIZE_KB (32 * 1024)
+#endif
+
+// Max size of the disposed sprites still waiting to be compressed, in bytes
+#if AGS_PLATFORM_OS_ANDROID || AGS_PLATFORM_OS_IOS
+#define PENDINGCOMPRESSSIZE_KB (2 * 1024)
+#else
+#define PENDINGCOMPRESSSIZE_KB (8 * 1024)
+#endif
+
 struct SpriteInfo;
 
 namespace AGS {
@@ -88,6 +104,14 @@ public:
 	static const sprkey_t MAX_SPRITE_INDEX = INT32_MAX - 1;
 	static const size_t   MAX_SPRITE_SLOTS = INT32_MAX;
 
+	// Counters of the sprite requests, for the diagnostics
+	struct Statistics {
+		uint32_t Hits = 0;       // sprite was in the cache
+		uint32_t Loads = 0;      // sprite was loaded from the sprite file
+		uint32_t Restores = 0;   // sprite was unpacked from its compressed copy
+		uint32_t Prefetches = 0; // sprite was loaded in advance
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos);
 	~SpriteCache();
 
@@ -141,19 +165,51 @@ public:
 	void        SubstituteBitmap(sprkey_t index, Shared::Bitmap *);
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
+	// Returns current size of the compressed sprite copies, in bytes
+	size_t      GetCompressedSize() const;
+	// Returns maximal size limit of the compressed sprite copies, in bytes
+	size_t      GetMaxCompressedSize() const;
+	// Sets max size of the compressed sprite copies in bytes; 0 disables them
+	void        SetMaxCompressedSize(size_t size);
+	// Returns current size of the disposed sprites waiting to be compressed, in bytes
+	size_t      GetPendingCompressSize() const;
+	// Compresses the disposed sprites waiting for it, oldest first, until
+	// the given time in milliseconds is spent or there are none left
+	void        CompressPending(uint32_t time_budget_ms);
+	// Loads the sprite in advance, if it is not loaded yet and there's
+	// a free space in cache for it; the sprite is not locked
+	void        Prefetch(sprkey_t index);
+	// Returns the counters of the sprite requests
+	const Statistics &GetStatistics() const { return _stats; }
+	void        ResetStatistics() { _stats = Statistics(); }
 
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Shared::Bitmap *operator[](sprkey_t index);
 
 private:
 	void        Init();
-	// Load sprite from game resource
-	size_t      LoadSprite(sprkey_t index);
+	// Load sprite from game resource; prefetched loads are not counted
+	// as loads or restores in the statistics
+	size_t      LoadSprite(sprkey_t index, bool prefetch = false);
 	// Gets the index of a sprite which data is used for the given slot;
 	// in case of remapped sprite this will return the one given sprite is remapped to
 	sprkey_t    GetDataIndex(sprkey_t index);
 	// Delete the oldest image in cache
 	void        DisposeOldest();
+	// Marks the sprite as the most recently used one
+	void        TouchMRU(sprkey_t index);
+	// Takes over the image of the sprite which is being disposed, so that
+	// it may be compressed later by CompressPending()
+	void        QueueCompressed(sprkey_t index);
+	// Keeps a compressed copy of the disposed sprite image
+	void        StoreCompressed(sprkey_t index, const Shared::Bitmap *image);
+	// Recreates the sprite image from its compressed copy, or takes it back
+	// if it is still waiting to be compressed
+	Shared::Bitmap *RestoreCompressed(sprkey_t index);
+	// Deletes the compressed or pending copy of the sprite, if there is one
+	void        RemoveCompressed(sprkey_t index);
+	void        RemovePending(sprkey_t index);
+	void        RemoveAllCompressed();
 
 	// Information required for the sprite streaming
 	struct SpriteData {
@@ -195,6 +251,35 @@ private:
 	int _liststart;
 	int _listend;
 
+	// Compressed copies of the asset sprites removed from the cache. These are
+	// much cheaper to restore than reloading and converting the sprite again,
+	// which saves time when the game returns to the recently visited rooms.
+	struct CompressedSprite {
+		std::vector<uint8_t> Data; // RLE packed image rows
+		int ColorDepth = 0;
+		std::list<sprkey_t>::iterator Order; // position in _compressedOrder
+	};
+	std::unordered_map<sprkey_t, CompressedSprite> _compressed;
+	// Compressed sprites from the oldest to the most recently stored
+	std::list<sprkey_t> _compressedOrder;
+	size_t _compressedSize;    // size in bytes of the compressed sprites
+	size_t _maxCompressedSize; // compressed sprites size limit
+
+	// Disposed sprites which are not compressed yet. Compressing them right
+	// away would stall the frame which evicted them, so this is done in the
+	// spare time at the end of the following frames.
+	struct PendingSprite {
+		Shared::Bitmap *Image = nullptr;
+		size_t Size = 0;
+		std::list<sprkey_t>::iterator Order; // position in _pendingOrder
+	};
+	std::unordered_map<sprkey_t, PendingSprite> _pending;
+	// Pending sprites from the oldest to the most recently disposed
+	std::list<sprkey_t> _pendingOrder;
+	size_t _pendingSize; // size in bytes of the pending sprite images
+
+	Statistics _stats;
+
 	// Initialize the empty sprite slot
 	void        InitNullSpriteParams(sprkey_t index);
 };
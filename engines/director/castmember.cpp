@@ -48,6 +48,7 @@ CastMember::CastMember(Cast *cast, uint16 castId, Common::SeekableReadStreamEndi
 	_flags1 = 0;
 
 	_modified = true;
+	_modifiedCount = 0;
 
 	_objType = kCastMemberObj;
 
@@ -929,7 +930,7 @@ TextCastMember::TextCastMember(Cast *cast, uint16 castId, Common::SeekableReadSt
 
 	_bgcolor = g_director->_wm->findBestColor(_bgpalinfo1 & 0xff, _bgpalinfo2 & 0xff, _bgpalinfo3 & 0xff);
 
-	_modified = true;
+	setModified(true);
 }
 
 void TextCastMember::setColors(uint32 *fgcolor, uint32 *bgcolor) {
@@ -943,7 +944,7 @@ void TextCastMember::setColors(uint32 *fgcolor, uint32 *bgcolor) {
 	if (_widget)
 		((Graphics::MacText *)_widget)->setColors(_fgcolor, _bgcolor);
 	else
-		_modified = true;
+		setModified(true);
 }
 
 Graphics::TextAlign TextCastMember::getAlignment() {
@@ -1044,7 +1045,7 @@ void TextCastMember::setText(const Common::U32String &text) {
 	Common::U32String formatting = Common::String::format("\001\016%04x%02x%04x%04x%04x%04x", _fontId, _textSlant, _fontSize, _fgpalinfo1, _fgpalinfo2, _fgpalinfo3);
 	_ptext = text;
 	_ftext = formatting + text;
-	_modified = true;
+	setModified(true);
 }
 
 // D4 dictionary book said this is line spacing
@@ -1075,7 +1076,7 @@ void TextCastMember::setTextSize(int textSize) {
 		((Graphics::MacText *)_widget)->draw();
 	} else {
 		_fontSize = textSize;
-		_modified = true;
+		setModified(true);
 	}
 }
 
@@ -73,7 +73,14 @@ public:
 	virtual bool isEditable() { return false; }
 	virtual void setEditable(bool editable) {}
 	virtual bool isModified() { return _modified; }
-	virtual void setModified(bool modified) { _modified = modified; }
+	virtual void setModified(bool modified) {
+		_modified = modified;
+		if (modified)
+			_modifiedCount++;
+	}
+	// Bumped on every modification, unlike _modified which the channel
+	// showing the member clears once it has been redrawn
+	uint32 getModifiedCount() const { return _modifiedCount; }
 	virtual Graphics::MacWidget *createWidget(Common::Rect &bbox, Channel *channel, SpriteType spriteType) { return nullptr; }
 	virtual void updateWidget(Graphics::MacWidget *widget, Channel *channel) {}
 	virtual void updateFromWidget(Graphics::MacWidget *widget) {}
@@ -110,6 +117,7 @@ protected:
 	// a link to the widget we created, we may use it later
 	Graphics::MacWidget *_widget;
 	bool _modified;
+	uint32 _modifiedCount;
 };
 
 class BitmapCastMember : public CastMember {
@@ -46,6 +46,9 @@ Channel::Channel(Sprite *sp, int priority) {
 	_delta = Common::Point(0, 0);
 	_constraint = 0;
 	_mask = nullptr;
+	_maskMember = nullptr;
+	_maskModifiedCount = 0;
+	_maskWidth = _maskHeight = 0;
 
 	_priority = priority;
 	_width = _sprite ? _sprite->_width : 0;
@@ -77,6 +80,9 @@ Channel& Channel::operator=(const Channel &channel) {
 	_delta = channel._delta;
 	_constraint = channel._constraint;
 	_mask = nullptr;
+	_maskMember = nullptr;
+	_maskModifiedCount = 0;
+	_maskWidth = _maskHeight = 0;
 
 	_priority = channel._priority;
 	_width = channel._width;
@@ -165,12 +171,26 @@ const Graphics::Surface *Channel::getMask(bool forceMatte) {
 		CastMember *member = g_director->getCurrentMovie()->getCastMember(maskID);
 
 		if (member && member->_initialRect == _sprite->_cast->_initialRect) {
+			// The mask is requested on every redraw of the sprite, so it is kept
+			// while the mask member and the sprite size stay the same. Videos
+			// and film loops change on their own, so they are never cached.
+			bool animated = member->_type == kCastDigitalVideo || member->_type == kCastFilmLoop;
+			if (_mask && !animated && _maskMember == member && _maskId == maskID &&
+					_maskModifiedCount == member->getModifiedCount() &&
+					_maskWidth == bbox.width() && _maskHeight == bbox.height())
+				return &_mask->rawSurface();
+
 			Graphics::MacWidget *widget = member->createWidget(bbox, this, _sprite->_spriteType);
 			if (_mask)
 				delete _mask;
 			_mask = new Graphics::ManagedSurface();
 			_mask->copyFrom(*widget->getSurface());
 			delete widget;
+			_maskMember = member;
+			_maskId = maskID;
+			_maskModifiedCount = member->getModifiedCount();
+			_maskWidth = bbox.width();
+			_maskHeight = bbox.height();
 			return &_mask->rawSurface();
 		} else {
 			warning("Channel::getMask(): Requested cast mask, but no matching mask was found");
@@ -32,6 +32,7 @@ namespace Graphics {
 
 namespace Director {
 
+class CastMember;
 class Sprite;
 class Cursor;
 
@@ -99,6 +100,12 @@ public:
 	Common::Point _currentPoint;
 	Common::Point _delta;
 	Graphics::ManagedSurface *_mask;
+	// What _mask was made of, so that it is only rebuilt when these change
+	CastMember *_maskMember;
+	CastMemberID _maskId;
+	uint32 _maskModifiedCount;
+	int16 _maskWidth;
+	int16 _maskHeight;
 
 	int _priority;
 	int _width;
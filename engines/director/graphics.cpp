@@ -408,6 +408,177 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+// Colourization of the source pixels for the copy inks. The result only depends
+// on the source colour, so it is remembered instead of being looked up with
+// findBestColor for every pixel.
+class InkColorCache {
+public:
+	InkColorCache(DirectorPlotData *p, bool inverted) : _p(p), _inverted(inverted) {
+		memset(_valid, 0, sizeof(_valid));
+	}
+
+	uint32 colorize(uint32 src) {
+		uint slot = (src ^ (src >> 8) ^ (src >> 16)) & (kSize - 1);
+		if (!_valid[slot] || _keys[slot] != src) {
+			byte rSrc, gSrc, bSrc;
+			byte rFor, gFor, bFor;
+			byte rBak, gBak, bBak;
+
+			g_director->_wm->decomposeColor(src, rSrc, gSrc, bSrc);
+			g_director->_wm->decomposeColor(_p->foreColor, rFor, gFor, bFor);
+			g_director->_wm->decomposeColor(_p->backColor, rBak, gBak, bBak);
+
+			if (_inverted)
+				_values[slot] = _p->_wm->findBestColor((~rSrc | rFor) & (rSrc | rBak),
+				                                       (~gSrc | gFor) & (gSrc | gBak),
+				                                       (~bSrc | bFor) & (bSrc | bBak));
+			else
+				_values[slot] = _p->_wm->findBestColor((rSrc | rFor) & (~rSrc | rBak),
+				                                       (gSrc | gFor) & (~gSrc | gBak),
+				                                       (bSrc | bFor) & (~bSrc | bBak));
+			_keys[slot] = src;
+			_valid[slot] = true;
+		}
+		return _values[slot];
+	}
+
+private:
+	enum { kSize = 256 };
+
+	DirectorPlotData *_p;
+	bool _inverted;
+	bool _valid[kSize];
+	uint32 _keys[kSize];
+	uint32 _values[kSize];
+};
+
+// Blits the surface with the given ink operation, one row at a time. This is
+// the same as going through inkDrawPixel for every pixel, but the ink is
+// chosen once per blit instead of once per pixel.
+template <typename T, typename InkOp>
+static void inkBlitRows(DirectorPlotData *p, const Common::Rect &srcRect, const Graphics::Surface *mask, InkOp op) {
+	const int srcX = abs(srcRect.left - p->destRect.left);
+	const int srcY = abs(srcRect.top - p->destRect.top);
+
+	for (int i = 0; i < p->destRect.height(); i++) {
+		T *dst = (T *)p->dst->getBasePtr(p->destRect.left, p->destRect.top + i);
+		const T *src = (const T *)p->srf->getBasePtr(srcX, srcY + i);
+
+		if (mask) {
+			const T *msk = (const T *)mask->getBasePtr(srcX, srcY + i);
+			for (int j = 0; j < p->destRect.width(); j++) {
+				if (!msk[j])
+					op(dst[j], src[j]);
+			}
+		} else {
+			for (int j = 0; j < p->destRect.width(); j++)
+				op(dst[j], src[j]);
+		}
+	}
+}
+
+struct InkCopyOp {
+	template <typename T> void operator()(T &dst, T src) const { dst = src; }
+};
+
+struct InkBackgndTransOp {
+	uint32 backColor;
+	template <typename T> void operator()(T &dst, T src) const { if ((uint32)src != backColor) dst = src; }
+};
+
+struct InkColorizeOp {
+	InkColorCache *cache;
+	bool backgndTrans;
+	uint32 backColor;
+	template <typename T> void operator()(T &dst, T src) const {
+		if (!backgndTrans || (uint32)src != backColor)
+			dst = cache->colorize(src);
+	}
+};
+
+struct InkTransparentOp {
+	uint32 foreColor;
+	template <typename T> void operator()(T &dst, T src) const { dst = (~(uint32)src & foreColor) | (dst & src); }
+};
+
+struct InkNotTransOp {
+	uint32 foreColor;
+	template <typename T> void operator()(T &dst, T src) const { dst = ((uint32)src & foreColor) | (dst & ~(uint32)src); }
+};
+
+struct InkReverseOp {
+	template <typename T> void operator()(T &dst, T src) const { dst ^= ~(uint32)src; }
+};
+
+struct InkNotReverseOp {
+	template <typename T> void operator()(T &dst, T src) const { dst ^= src; }
+};
+
+struct InkGhostOp {
+	uint32 backColor;
+	template <typename T> void operator()(T &dst, T src) const { dst = ((uint32)src | backColor) & (dst | ~(uint32)src); }
+};
+
+struct InkNotGhostOp {
+	uint32 backColor;
+	template <typename T> void operator()(T &dst, T src) const { dst = (~(uint32)src | backColor) & (dst | src); }
+};
+
+template <typename T>
+static bool inkBlitSurfaceRows(DirectorPlotData *p, const Common::Rect &srcRect, const Graphics::Surface *mask) {
+	// Without colourization, the ghost inks behave as if the background colour
+	// had all bits set
+	const uint32 ghostColor = p->applyColor ? p->backColor : 0xffffffff;
+
+	switch (p->ink) {
+	case kInkTypeBackgndTrans:
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeCopy:
+	case kInkTypeNotCopy:
+		if (p->applyColor) {
+			InkColorCache cache(p, p->ink == kInkTypeNotCopy);
+			InkColorizeOp op = { &cache, p->ink == kInkTypeBackgndTrans, p->backColor };
+			inkBlitRows<T>(p, srcRect, mask, op);
+		} else if (p->ink == kInkTypeBackgndTrans) {
+			InkBackgndTransOp op = { p->backColor };
+			inkBlitRows<T>(p, srcRect, mask, op);
+		} else {
+			inkBlitRows<T>(p, srcRect, mask, InkCopyOp());
+		}
+		return true;
+	case kInkTypeTransparent: {
+		InkTransparentOp op = { p->applyColor ? p->foreColor : 0 };
+		inkBlitRows<T>(p, srcRect, mask, op);
+		return true;
+	}
+	case kInkTypeNotTrans: {
+		InkNotTransOp op = { p->applyColor ? p->foreColor : 0 };
+		inkBlitRows<T>(p, srcRect, mask, op);
+		return true;
+	}
+	case kInkTypeReverse:
+		inkBlitRows<T>(p, srcRect, mask, InkReverseOp());
+		return true;
+	case kInkTypeNotReverse:
+		inkBlitRows<T>(p, srcRect, mask, InkNotReverseOp());
+		return true;
+	case kInkTypeGhost: {
+		InkGhostOp op = { ghostColor };
+		inkBlitRows<T>(p, srcRect, mask, op);
+		return true;
+	}
+	case kInkTypeNotGhost: {
+		InkNotGhostOp op = { ghostColor };
+		inkBlitRows<T>(p, srcRect, mask, op);
+		return true;
+	}
+	default:
+		// Arithmetic inks need the colour components of both pixels
+		return false;
+	}
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -416,6 +587,16 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	if (sprite == kTextSprite)
 		applyColor = false;
 
+	// Text sprites get their colours preprocessed per pixel, and blended
+	// sprites are composed in inkDrawPixel
+	if (sprite != kTextSprite && !alpha) {
+		bool done = (_wm->_pixelformat.bytesPerPixel == 1) ?
+			inkBlitSurfaceRows<byte>(this, srcRect, mask) :
+			inkBlitSurfaceRows<uint32>(this, srcRect, mask);
+		if (done)
+			return;
+	}
+
 	srcPoint.y = abs(srcRect.top - destRect.top);
 	for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
 		if (_wm->_pixelformat.bytesPerPixel == 1) {
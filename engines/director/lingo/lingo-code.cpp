@@ -188,7 +188,7 @@ void Lingo::cleanupFuncs() {
 		delete it->_value;
 }
 
-void Lingo::push(Datum d) {
+void Lingo::push(const Datum &d) {
 	_stack.push_back(d);
 }
 
@@ -561,9 +561,8 @@ void LC::c_stackdrop() {
 }
 
 void LC::c_assign() {
-	Datum d1, d2;
-	d1 = g_lingo->pop();
-	d2 = g_lingo->pop();
+	Datum d1 = g_lingo->pop();
+	Datum d2 = g_lingo->pop();
 
 	g_lingo->varAssign(d1, d2);
 }
@@ -701,15 +700,13 @@ Datum LC::addData(Datum &d1, Datum &d2) {
 
 	int alignedType = g_lingo->getAlignedType(d1, d2, true);
 
-	Datum res;
-	if (alignedType == FLOAT) {
-		res = Datum(d1.asFloat() + d2.asFloat());
-	} else if (alignedType == INT) {
-		res = Datum(d1.asInt() + d2.asInt());
-	} else {
-		warning("LC::addData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
-	}
-	return res;
+	if (alignedType == FLOAT)
+		return Datum(d1.asFloat() + d2.asFloat());
+	if (alignedType == INT)
+		return Datum(d1.asInt() + d2.asInt());
+
+	warning("LC::addData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
+	return Datum();
 }
 
 void LC::c_add() {
@@ -725,15 +722,13 @@ Datum LC::subData(Datum &d1, Datum &d2) {
 
 	int alignedType = g_lingo->getAlignedType(d1, d2, true);
 
-	Datum res;
-	if (alignedType == FLOAT) {
-		res = Datum(d1.asFloat() - d2.asFloat());
-	} else if (alignedType == INT) {
-		res = Datum(d1.asInt() - d2.asInt());
-	} else {
-		warning("LC::subData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
-	}
-	return res;
+	if (alignedType == FLOAT)
+		return Datum(d1.asFloat() - d2.asFloat());
+	if (alignedType == INT)
+		return Datum(d1.asInt() - d2.asInt());
+
+	warning("LC::subData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
+	return Datum();
 }
 
 void LC::c_sub() {
@@ -749,15 +744,13 @@ Datum LC::mulData(Datum &d1, Datum &d2) {
 
 	int alignedType = g_lingo->getAlignedType(d1, d2, true);
 
-	Datum res;
-	if (alignedType == FLOAT) {
-		res = Datum(d1.asFloat() * d2.asFloat());
-	} else if (alignedType == INT) {
-		res = Datum(d1.asInt() * d2.asInt());
-	} else {
-		warning("LC::mulData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
-	}
-	return res;
+	if (alignedType == FLOAT)
+		return Datum(d1.asFloat() * d2.asFloat());
+	if (alignedType == INT)
+		return Datum(d1.asInt() * d2.asInt());
+
+	warning("LC::mulData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
+	return Datum();
 }
 
 void LC::c_mul() {
@@ -782,16 +775,13 @@ Datum LC::divData(Datum &d1, Datum &d2) {
 	if (g_director->getVersion() < 400)	// pre-D4 is INT-only
 		alignedType = INT;
 
-	Datum res;
-	if (alignedType == FLOAT) {
-		res = Datum(d1.asFloat() / d2.asFloat());
-	} else if (alignedType == INT) {
-		res = Datum(d1.asInt() / d2.asInt());
-	} else {
-		warning("LC::divData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
-	}
+	if (alignedType == FLOAT)
+		return Datum(d1.asFloat() / d2.asFloat());
+	if (alignedType == INT)
+		return Datum(d1.asInt() / d2.asInt());
 
-	return res;
+	warning("LC::divData(): not supported between types %s and %s", d1.type2str(), d2.type2str());
+	return Datum();
 }
 
 void LC::c_div() {
@@ -45,6 +45,7 @@
 #include "common/endian.h"
 
 #include "director/director.h"
+#include "director/cast.h"
 #include "director/movie.h"
 #include "director/lingo/lingo.h"
 #include "director/lingo/lingo-ast.h"
@@ -98,6 +99,7 @@ LingoCompiler::LingoCompiler() {
 
 	_indef = false;
 	_methodVars = nullptr;
+	_assemblyHasFactory = false;
 
 	_linenumber = _colnumber = _bytenumber = 0;
 	_lines[0] = _lines[1] = _lines[2] = nullptr;
@@ -109,6 +111,66 @@ LingoCompiler::LingoCompiler() {
 	_hadError = false;
 }
 
+LingoCompiler::~LingoCompiler() {
+	clearScriptCache();
+}
+
+void LingoCompiler::clearScriptCache() {
+	for (Common::HashMap<Common::String, CachedScript>::iterator it = _scriptCache.begin(); it != _scriptCache.end(); ++it)
+		delete it->_value.context;
+	_scriptCache.clear();
+}
+
+// Copies the handlers of a script context. Unlike the ScriptContext copy
+// constructor, which creates script instances, this makes another script.
+static ScriptContext *copyScriptContext(const ScriptContext *sc) {
+	ScriptContext *res = new ScriptContext(sc->getName(), sc->_scriptType, sc->_id);
+	res->setFactory(sc->isFactory());
+	res->_functionNames = sc->_functionNames;
+	for (SymbolHash::const_iterator it = sc->_functionHandlers.begin(); it != sc->_functionHandlers.end(); ++it) {
+		res->_functionHandlers[it->_key] = it->_value;
+		res->_functionHandlers[it->_key].ctx = res;
+	}
+	for (Common::HashMap<uint32, Symbol>::const_iterator it = sc->_eventHandlers.begin(); it != sc->_eventHandlers.end(); ++it) {
+		res->_eventHandlers[it->_key] = it->_value;
+		res->_eventHandlers[it->_key].ctx = res;
+	}
+	res->_constants = sc->_constants;
+	res->_properties = sc->_properties;
+	return res;
+}
+
+Common::String LingoCompiler::getScriptCacheKey(const Common::U32String &code, LingoArchive *archive, ScriptType type, CastMemberID id, const Common::String &scriptName, bool anonymous) {
+	// Everything the preprocessor and the code generator depend on
+	bool outdatedLingo = g_director->getCurrentMovie() && g_director->getCurrentMovie()->_allowOutdatedLingo;
+	Common::String key = Common::String::format("%d:%d:%d:%d:%d:", type, id.member, id.castLib, anonymous, outdatedLingo);
+	key += scriptName;
+	key += '\n';
+	// Script patches are specific to the movie
+	if (archive)
+		key += g_director->getCurrentPath() + archive->cast->getMacName();
+	key += '\n';
+	key += code.encode(Common::kUtf8);
+	return key;
+}
+
+ScriptContext *LingoCompiler::compileCachedLingo(const CachedScript &cached, LingoArchive *archive) {
+	ScriptContext *sc = copyScriptContext(cached.context);
+
+	// Repeat what compiling the script registers
+	for (uint i = 0; i < cached.globals.size(); i++) {
+		if (!g_lingo->_globalvars.contains(cached.globals[i]))
+			g_lingo->_globalvars[cached.globals[i]] = Datum();
+	}
+
+	for (SymbolHash::iterator it = sc->_functionHandlers.begin(); it != sc->_functionHandlers.end(); ++it) {
+		if (!archive->functionHandlers.contains(it->_key)) {
+			archive->functionHandlers[it->_key] = it->_value;
+		}
+	}
+	return sc;
+}
+
 ScriptContext *LingoCompiler::compileAnonymous(const Common::U32String &code) {
 	debugC(1, kDebugCompile, "Compiling anonymous lingo\n"
 			"***********\n%s\n\n***********", code.encode().c_str());
@@ -117,12 +179,21 @@ ScriptContext *LingoCompiler::compileAnonymous(const Common::U32String &code) {
 }
 
 ScriptContext *LingoCompiler::compileLingo(const Common::U32String &code, LingoArchive *archive, ScriptType type, CastMemberID id, const Common::String &scriptName, bool anonymous) {
+	Common::String cacheKey = getScriptCacheKey(code, archive, type, id, scriptName, anonymous);
+	if (_scriptCache.contains(cacheKey)) {
+		debugC(2, kDebugCompile, "Using the cached compilation of '%s'", scriptName.c_str());
+		_hadError = false;
+		return compileCachedLingo(_scriptCache[cacheKey], archive);
+	}
+
 	_assemblyArchive = archive;
 	_assemblyAST = nullptr;
 	ScriptContext *mainContext = _assemblyContext = new ScriptContext(scriptName, type, id.member);
 	_currentAssembly = new ScriptData;
 
 	_methodVars = new VarTypeHash;
+	_assemblyGlobals.clear();
+	_assemblyHasFactory = false;
 	_linenumber = _colnumber = 1;
 	_hadError = false;
 
@@ -223,6 +294,17 @@ ScriptContext *LingoCompiler::compileLingo(const Common::U32String &code, LingoA
 	_assemblyAST = nullptr;
 	_assemblyContext = nullptr;
 	_assemblyArchive = nullptr;
+
+	// Scripts with parse errors are not cached, so that compiling them again
+	// reports the errors again
+	if (!_assemblyHasFactory && !_hadError) {
+		if (_scriptCache.size() >= kMaxCachedScripts)
+			clearScriptCache();
+		CachedScript &cached = _scriptCache[cacheKey];
+		cached.context = copyScriptContext(mainContext);
+		cached.globals = _assemblyGlobals;
+	}
+
 	return mainContext;
 }
 
@@ -364,6 +446,7 @@ void LingoCompiler::registerMethodVar(const Common::String &name, VarType type)
 		} else if (type == kVarGlobal) {
 			if (!g_lingo->_globalvars.contains(name))
 				g_lingo->_globalvars[name] = Datum();
+			_assemblyGlobals.push_back(name);
 		}
 	}
 }
@@ -372,6 +455,7 @@ void LingoCompiler::registerFactory(Common::String &name) {
 	_assemblyContext->setName(name);
 	_assemblyContext->setFactory(true);
 	g_lingo->_globalvars[name] = _assemblyContext;
+	_assemblyHasFactory = true;
 }
 
 void LingoCompiler::updateLoopJumps(uint nextTargetPos, uint exitTargetPos) {
@@ -31,7 +31,7 @@ namespace Director {
 class LingoCompiler : NodeVisitor {
 public:
 	LingoCompiler();
-	virtual ~LingoCompiler() {}
+	virtual ~LingoCompiler();
 
 	ScriptContext *compileAnonymous(const Common::U32String &code);
 	ScriptContext *compileLingo(const Common::U32String &code, LingoArchive *archive, ScriptType type, CastMemberID id, const Common::String &scriptName, bool anonyomous = false);
@@ -71,6 +71,27 @@ public:
 
 	bool _hadError;
 
+	void clearScriptCache();
+
+private:
+	// Scripts already compiled from the same source. Movies share their
+	// shared cast scripts, and games switching between movies would
+	// otherwise parse all of them again on every movie load.
+	enum { kMaxCachedScripts = 8192 };
+	struct CachedScript {
+		ScriptContext *context;
+		// Globals declared by the script, which compiling it registers
+		Common::Array<Common::String> globals;
+	};
+	Common::HashMap<Common::String, CachedScript> _scriptCache;
+	// Globals declared by the script being compiled
+	Common::Array<Common::String> _assemblyGlobals;
+	// Factories are separate script contexts, so scripts defining them are not cached
+	bool _assemblyHasFactory;
+
+	Common::String getScriptCacheKey(const Common::U32String &code, LingoArchive *archive, ScriptType type, CastMemberID id, const Common::String &scriptName, bool anonymous);
+	ScriptContext *compileCachedLingo(const CachedScript &cached, LingoArchive *archive);
+
 public:
 	virtual bool visitScriptNode(ScriptNode *node);
 	virtual bool visitFactoryNode(FactoryNode *node);
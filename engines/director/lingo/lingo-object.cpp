@@ -1019,7 +1019,7 @@ bool TextCastMember::setField(int field, const Datum &d) {
 		// TODO: Understand how texts can be selected programmatically as well.
 		// since hilite won't affect text castmember, and we may have button info in text cast in D2/3. so don't check type here
 		_hilite = (bool)d.asInt();
-		_modified = true;
+		setModified(true);
 		return true;
 		break;
 	case kTheText:
@@ -1043,7 +1043,7 @@ bool TextCastMember::setField(int field, const Datum &d) {
 			}
 
 			_textAlign = align;
-			_modified = true;
+			setModified(true);
 	}
 		return true;
 	case kTheTextFont:
@@ -1054,12 +1054,12 @@ bool TextCastMember::setField(int field, const Datum &d) {
 		((Graphics::MacText *)toEdit->_widget)->enforceTextFont((uint16) g_director->_wm->_fontMan->getFontIdByName(d.asString()));
 		_ptext = ((Graphics::MacText *)toEdit->_widget)->getPlainText();
 		_ftext = ((Graphics::MacText *)toEdit->_widget)->getTextChunk(0, 0, -1, -1, true);
-		_modified = true;
+		setModified(true);
 		toEdit->_widget->removeWidget(_widget);
 		return true;
 	case kTheTextHeight:
 		_lineSpacing = d.asInt();
-		_modified = true;
+		setModified(true);
 		return false;
 	case kTheTextSize:
 		if (!toEdit) {
@@ -1069,7 +1069,7 @@ bool TextCastMember::setField(int field, const Datum &d) {
 		((Graphics::MacText *)toEdit->_widget)->setTextSize(d.asInt());
 		_ptext = ((Graphics::MacText *)toEdit->_widget)->getPlainText();
 		_ftext = ((Graphics::MacText *)toEdit->_widget)->getTextChunk(0, 0, -1, -1, true);
-		_modified = true;
+		setModified(true);
 		toEdit->_widget->removeWidget(_widget);
 		return true;
 	case kTheTextStyle:
@@ -1083,7 +1083,7 @@ bool TextCastMember::setField(int field, const Datum &d) {
 		}
 		_ptext = ((Graphics::MacText *)toEdit->_widget)->getPlainText();
 		_ftext = ((Graphics::MacText *)toEdit->_widget)->getTextChunk(0, 0, -1, -1, true);
-		_modified = true;
+		setModified(true);
 		toEdit->_widget->removeWidget(_widget);
 		return true;
 	default:
@@ -439,7 +439,7 @@ public:
 	Common::String _floatPrecisionFormat;
 
 public:
-	void push(Datum d);
+	void push(const Datum &d);
 	Datum pop();
 	Datum peek(uint offset);
 
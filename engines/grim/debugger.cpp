@@ -25,6 +25,7 @@
 #include "engines/grim/debugger.h"
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
+#include "engines/grim/gfx_base.h"
 
 namespace Grim {
 
@@ -37,6 +38,7 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("draw_stats", WRAP_METHOD(Debugger, cmd_draw_stats));
 }
 
 Debugger::~Debugger() {
@@ -126,4 +128,15 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_draw_stats(int argc, const char **argv) {
+	if (!g_driver) {
+		debugPrintf("No renderer is active.\n");
+		return true;
+	}
+
+	const GfxBase::DrawStatistics &stats = g_driver->getLastFrameStatistics();
+	debugPrintf("Last frame: %u draw calls, %u faces, %u texture changes\n", stats.drawCalls, stats.faces, stats.textureChanges);
+	return true;
+}
+
 }
@@ -39,6 +39,7 @@ public:
 	bool cmd_set_renderer(int argc, const char **argv);
 	bool cmd_save(int argc, const char **argv);
 	bool cmd_load(int argc, const char **argv);
+	bool cmd_draw_stats(int argc, const char **argv);
 };
 
 }
@@ -236,26 +236,39 @@ void EMIModel::prepareForRender() {
 		_drawNormals[i].set(0.0f, 0.0f, 0.0f);
 	}
 
+	// Moving a vertex from the bind pose of a joint and applying the joint
+	// transform is the same for all the vertices of the joint, so both are
+	// combined into one matrix per joint first.
+	_skinMatrices.resize(_skeleton->_numJoints);
+	for (int i = 0; i < _skeleton->_numJoints; i++) {
+		const Math::Matrix4 &bindPose = _skeleton->_joints[i]._absMatrix;
+		Math::Matrix3 invRotation = bindPose.getRotation();
+		invRotation.transpose();
+		Math::Vector3d invPosition = bindPose.getPosition();
+		invRotation.transformVector(&invPosition);
+
+		Math::Matrix4 invBindPose;
+		invBindPose.setRotation(invRotation);
+		invBindPose.setPosition(-invPosition);
+		_skinMatrices[i] = _skeleton->_joints[i]._finalMatrix * invBindPose;
+	}
+
 	int boneVert = -1;
 	for (int i = 0; i < _numBoneInfos; i++) {
 		if (_boneInfos[i]._incFac == 1) {
 			boneVert++;
 		}
 
-		int jointIndex = _vertexBoneInfo[i];
-		const Math::Matrix4 &jointMatrix = _skeleton->_joints[jointIndex]._finalMatrix;
-		const Math::Matrix4 &bindPose = _skeleton->_joints[jointIndex]._absMatrix;
+		const Math::Matrix4 &skinMatrix = _skinMatrices[_vertexBoneInfo[i]];
+		const float weight = _boneInfos[i]._weight;
 
 		Math::Vector3d vert = _vertices[boneVert];
-		vert -= bindPose.getPosition();
-		vert = vert * bindPose.getRotation();
-		jointMatrix.transform(&vert, true);
-		_drawVertices[boneVert] += vert * _boneInfos[i]._weight;
+		skinMatrix.transform(&vert, true);
+		_drawVertices[boneVert] += vert * weight;
 
 		Math::Vector3d normal = _normals[boneVert];
-		normal = normal * bindPose.getRotation();
-		jointMatrix.transform(&normal, false);
-		_drawNormals[boneVert] += normal * _boneInfos[i]._weight;
+		skinMatrix.transform(&normal, false);
+		_drawNormals[boneVert] += normal * weight;
 	}
 
 	for (int i = 0; i < _numVertices; i++) {
@@ -303,9 +316,20 @@ void EMIModel::draw() {
 	}
 	// We will need to add a call to the skeleton, to get the modified vertices, but for now,
 	// I'll be happy with just static drawing
-	for (uint32 i = 0; i < _numFaces; i++) {
-		setTex(_faces[i]._texID);
-		g_driver->drawEMIModelFace(this, &_faces[i]);
+	// Consecutive faces sharing the same texture and flags are submitted
+	// together. The faces are not reordered, as the blending of alpha
+	// textures depends on the drawing order.
+	for (uint32 i = 0; i < _numFaces; ) {
+		const EMIMeshFace &face = _faces[i];
+		uint32 count = 1;
+		while (i + count < _numFaces && _faces[i + count]._texID == face._texID &&
+		       _faces[i + count]._hasTexture == face._hasTexture && _faces[i + count]._flags == face._flags) {
+			count++;
+		}
+
+		setTex(face._texID);
+		g_driver->drawEMIModelFaces(this, &face, count);
+		i += count;
 	}
 
 	if (g_driver->supportsShaders() && actor->getLightMode() == Actor::LightNone) {
@@ -319,6 +343,7 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 	// performance optimization, but NormDyn mode is visually superior in all cases.
 
 	Common::Array<Grim::Light *> activeLights;
+	Common::Array<Math::Vector3d> lightColors;
 	bool hasAmbient = false;
 
 	Actor *actor = _costume->getOwner();
@@ -326,6 +351,9 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 	foreach(Light *l, g_grim->getCurrSet()->getLights(actor->isInOverworld())) {
 		if (l->_enabled) {
 			activeLights.push_back(l);
+			lightColors.push_back(Math::Vector3d(l->_color.getRed() / 255.0f,
+			                                     l->_color.getGreen() / 255.0f,
+			                                     l->_color.getBlue() / 255.0f));
 			if (l->_type == Light::Ambient)
 				hasAmbient = true;
 		}
@@ -337,8 +365,8 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 
 		Math::Vector3d normal = _drawNormals[i];
 		Math::Vector3d vertex = _drawVertices[i];
-		modelToWorld.transform(&vertex, true);
 		modelToWorld.transform(&normal, false);
+		modelToWorld.transform(&vertex, true);
 
 		for (uint j = 0; j < activeLights.size(); ++j) {
 			Light *l = activeLights[j];
@@ -380,12 +408,7 @@ void EMIModel::updateLighting(const Math::Matrix4 &modelToWorld) {
 				shade *= dot;
 			}
 
-			Math::Vector3d color;
-			color.x() = l->_color.getRed() / 255.0f;
-			color.y() = l->_color.getGreen() / 255.0f;
-			color.z() = l->_color.getBlue() / 255.0f;
-
-			result += color * shade;
+			result += lightColors[j] * shade;
 		}
 
 		if (!hasAmbient) {
@@ -54,7 +54,6 @@ class Skeleton;
 class EMIMeshFace {
 public:
 	Vector3int *_indexes;
-	uint32 _indicesEBO;
 	uint32 _faceLength;
 	uint32 _numFaces;
 	uint32 _hasTexture;
@@ -68,7 +67,7 @@ public:
 		kUnknownBlend = 0x40000 // used only in intro screen actors
 	};
 
-	EMIMeshFace() : _faceLength(0), _numFaces(0), _hasTexture(0), _texID(0), _flags(0), _indexes(NULL), _parent(NULL), _indicesEBO(0) { }
+	EMIMeshFace() : _faceLength(0), _numFaces(0), _hasTexture(0), _texID(0), _flags(0), _indexes(NULL), _parent(NULL) { }
 	~EMIMeshFace();
 	void loadFace(Common::SeekableReadStream *data);
 	void setParent(EMIModel *m) { _parent = m; }
@@ -113,6 +112,8 @@ public:
 	BoneInfo *_boneInfos;
 	Common::String *_boneNames;
 	int *_vertexBoneInfo;
+	// Per joint: the inverse of the bind pose followed by the joint transform
+	Common::Array<Math::Matrix4> _skinMatrices;
 
 	// Stuff we dont know how to use:
 	float _radius;
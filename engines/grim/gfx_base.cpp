@@ -40,6 +40,7 @@
 #include "engines/grim/bitmap.h"
 #include "engines/grim/grim.h"
 #include "engines/grim/model.h"
+#include "engines/grim/emi/modelemi.h"
 
 #include "graphics/surface.h"
 
@@ -104,6 +105,22 @@ void GfxBase::renderZBitmaps(bool render) {
 	_renderZBitmaps = render;
 }
 
+void GfxBase::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *faces, uint count) {
+	// Renderers without a batched path reset their state after each face,
+	// so the texture has to be selected again for every face but the first.
+	for (uint i = 0; i < count; i++) {
+		if (i > 0)
+			faces[i]._parent->setTex(faces[i]._texID);
+		drawEMIModelFace(model, &faces[i]);
+		recordDraw(1);
+	}
+}
+
+void GfxBase::endFrameStatistics() {
+	_lastFrameStats = _frameStats;
+	_frameStats = DrawStatistics();
+}
+
 void GfxBase::drawMesh(const Mesh *mesh) {
 	for (int i = 0; i < mesh->_numFaces; i++)
 		mesh->_faces[i].draw(mesh);
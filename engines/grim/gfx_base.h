@@ -68,6 +68,17 @@ enum colorFormat {
 };
 class GfxBase {
 public:
+	/**
+	 * Counts of the work submitted to the renderer during one frame.
+	 */
+	struct DrawStatistics {
+		DrawStatistics() : drawCalls(0), faces(0), textureChanges(0) { }
+
+		uint32 drawCalls;
+		uint32 faces;
+		uint32 textureChanges;
+	};
+
 	GfxBase();
 	virtual ~GfxBase() { ; }
 
@@ -137,6 +148,12 @@ public:
 	virtual void translateViewpointFinish() = 0;
 
 	virtual void drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) = 0;
+	/**
+	 * Draws consecutive faces of an EMI model which share the same texture
+	 * and flags. The texture of the first face must already be selected.
+	 * The renderer records the draw calls it actually issues.
+	 */
+	virtual void drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *faces, uint count);
 	virtual void drawModelFace(const Mesh *mesh, const MeshFace *face) = 0;
 	virtual void drawSprite(const Sprite *sprite) = 0;
 	virtual void drawMesh(const Mesh *mesh);
@@ -272,6 +289,16 @@ public:
 	Texture *getSpecialtyTexturePtr(Common::String name);
 
 	virtual void setBlendMode(bool additive) = 0;
+
+	void recordDraw(uint faces) { _frameStats.drawCalls++; _frameStats.faces += faces; }
+	void recordTextureChange() { _frameStats.textureChanges++; }
+	/**
+	 * Ends the statistics of the current frame, to be called when the
+	 * frame is presented.
+	 */
+	void endFrameStatistics();
+	const DrawStatistics &getLastFrameStatistics() const { return _lastFrameStats; }
+
 protected:
 	Bitmap *createScreenshotBitmap(Graphics::Surface *src, int w, int h, bool flipOrientation);
 	static const unsigned int _numSpecialtyTextures = 22;
@@ -293,6 +320,8 @@ protected:
 	Math::Vector3d _currentPos;
 	Math::Matrix4 _currentRot;
 	float _dimLevel;
+	DrawStatistics _frameStats;
+	DrawStatistics _lastFrameStats;
 };
 
 // Factory-like functions:
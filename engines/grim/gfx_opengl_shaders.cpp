@@ -121,6 +121,10 @@ struct EMIModelUserData {
 	uint32 _colorMapVBO;
 	uint32 _verticesVBO;
 	uint32 _normalsVBO;
+	uint32 _indicesEBO;
+	// Start of the indices of each face in _indicesEBO, followed by the
+	// total number of indices
+	Common::Array<uint32> _faceIndexStarts;
 };
 
 struct ModelUserData {
@@ -1053,6 +1057,14 @@ void GfxOpenGLS::updateEMIModel(const EMIModel* model) {
 }
 
 void GfxOpenGLS::drawEMIModelFace(const EMIModel* model, const EMIMeshFace* face) {
+	drawEMIModelFaces(model, face, 1);
+}
+
+void GfxOpenGLS::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *faces, uint count) {
+	// All the faces share the same texture and flags, and their indices
+	// follow each other in the index buffer of the model, so the whole
+	// range is drawn with a single call.
+	const EMIMeshFace *face = &faces[0];
 	if (face->_flags & EMIMeshFace::kAlphaBlend ||
 	    face->_flags & EMIMeshFace::kUnknownBlend)
 		glEnable(GL_BLEND);
@@ -1068,10 +1080,15 @@ void GfxOpenGLS::drawEMIModelFace(const EMIModel* model, const EMIMeshFace* face
 	actorShader->setUniform("useVertexAlpha", _selectedTexture->_hasAlpha);
 	actorShader->setUniform1f("meshAlpha", (model->_meshAlphaMode == Actor::AlphaReplace) ? model->_meshAlpha : 1.0f);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, face->_indicesEBO);
+	const uint32 firstFace = face - model->_faces;
+	const uint32 startIndex = mud->_faceIndexStarts[firstFace];
+	const uint32 endIndex = mud->_faceIndexStarts[firstFace + count];
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mud->_indicesEBO);
 
-	glDrawElements(GL_TRIANGLES, 3 * face->_faceLength, GL_UNSIGNED_SHORT, nullptr);
+	glDrawElements(GL_TRIANGLES, endIndex - startIndex, GL_UNSIGNED_SHORT, (void *)(startIndex * sizeof(uint16)));
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	recordDraw(count);
 }
 
 void GfxOpenGLS::drawMesh(const Mesh *mesh) {
@@ -2118,24 +2135,32 @@ void GfxOpenGLS::createEMIModel(EMIModel *model) {
 	actorShader->enableVertexAttribute("color", mud->_colorMapVBO, 4, GL_UNSIGNED_BYTE, GL_TRUE, 4 * sizeof(byte), 0);
 	mud->_shaderLights = actorShader;
 
+	// The indices of all the faces are kept in one buffer, in the order of
+	// the faces, so that consecutive faces can be drawn together
+	mud->_faceIndexStarts.resize(model->_numFaces + 1);
+	uint32 numIndices = 0;
 	for (uint32 i = 0; i < model->_numFaces; ++i) {
-		EMIMeshFace * face = &model->_faces[i];
-		face->_indicesEBO = OpenGL::ShaderGL::createBuffer(GL_ELEMENT_ARRAY_BUFFER, face->_faceLength * 3 * sizeof(uint16), face->_indexes, GL_STATIC_DRAW);
+		mud->_faceIndexStarts[i] = numIndices;
+		numIndices += model->_faces[i]._faceLength * 3;
 	}
+	mud->_faceIndexStarts[model->_numFaces] = numIndices;
+
+	uint16 *indices = new uint16[numIndices];
+	for (uint32 i = 0; i < model->_numFaces; ++i) {
+		const EMIMeshFace *face = &model->_faces[i];
+		memcpy(indices + mud->_faceIndexStarts[i], face->_indexes, face->_faceLength * 3 * sizeof(uint16));
+	}
+	mud->_indicesEBO = OpenGL::ShaderGL::createBuffer(GL_ELEMENT_ARRAY_BUFFER, numIndices * sizeof(uint16), indices, GL_STATIC_DRAW);
+	delete[] indices;
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
 void GfxOpenGLS::destroyEMIModel(EMIModel *model) {
-	for (uint32 i = 0; i < model->_numFaces; ++i) {
-		EMIMeshFace *face = &model->_faces[i];
-		OpenGL::ShaderGL::freeBuffer(face->_indicesEBO);
-		face->_indicesEBO = 0;
-	}
-
 	EMIModelUserData *mud = static_cast<EMIModelUserData *>(model->_userData);
 
 	if (mud) {
+		OpenGL::ShaderGL::freeBuffer(mud->_indicesEBO);
 		OpenGL::ShaderGL::freeBuffer(mud->_verticesVBO);
 		OpenGL::ShaderGL::freeBuffer(mud->_normalsVBO);
 		OpenGL::ShaderGL::freeBuffer(mud->_texCoordsVBO);
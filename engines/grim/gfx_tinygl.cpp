@@ -619,7 +619,13 @@ void GfxTinyGL::set3DMode() {
 }
 
 void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) {
-	uint16 *indices = (uint16 *)face->_indexes;
+	drawEMIModelFaces(model, face, 1);
+}
+
+void GfxTinyGL::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *faces, uint count) {
+	// All the faces share the same texture and flags, so the state is set
+	// up once and the triangles of all faces go into a single draw call.
+	const EMIMeshFace *face = &faces[0];
 
 	tglEnable(TGL_DEPTH_TEST);
 	tglDisable(TGL_ALPHA_TEST);
@@ -637,28 +643,30 @@ void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face)
 		alpha *= model->_meshAlpha;
 	}
 	Math::Vector3d noLighting(1.f, 1.f, 1.f);
-	for (uint j = 0; j < face->_faceLength * 3; j++) {
-		uint16 index = indices[j];
+	for (uint f = 0; f < count; f++) {
+		const uint16 *indices = (const uint16 *)faces[f]._indexes;
 
-		if (!_currentShadowArray) {
-			if (face->_hasTexture) {
-				tglTexCoord2f(model->_texVerts[index].getX(), model->_texVerts[index].getY());
-			}
-			Math::Vector3d lighting = (face->_flags & EMIMeshFace::kNoLighting) ? noLighting : model->_lighting[index];
-			byte r = (byte)(model->_colorMap[index].r * lighting.x());
-			byte g = (byte)(model->_colorMap[index].g * lighting.y());
-			byte b = (byte)(model->_colorMap[index].b * lighting.z());
-			byte a = (int)(alpha * (model->_meshAlphaMode == Actor::AlphaReplace ? model->_colorMap[index].a * _currentActor->getLocalAlpha(index) : 255.f));
-			tglColor4ub(r, g, b, a);
-		}
+		for (uint j = 0; j < faces[f]._faceLength * 3; j++) {
+			uint16 index = indices[j];
 
-		Math::Vector3d normal = model->_normals[index];
-		Math::Vector3d vertex = model->_drawVertices[index];
+			if (!_currentShadowArray) {
+				if (face->_hasTexture) {
+					tglTexCoord2f(model->_texVerts[index].getX(), model->_texVerts[index].getY());
+				}
+				Math::Vector3d lighting = (face->_flags & EMIMeshFace::kNoLighting) ? noLighting : model->_lighting[index];
+				byte r = (byte)(model->_colorMap[index].r * lighting.x());
+				byte g = (byte)(model->_colorMap[index].g * lighting.y());
+				byte b = (byte)(model->_colorMap[index].b * lighting.z());
+				byte a = (int)(alpha * (model->_meshAlphaMode == Actor::AlphaReplace ? model->_colorMap[index].a * _currentActor->getLocalAlpha(index) : 255.f));
+				tglColor4ub(r, g, b, a);
+			}
 
-		tglNormal3fv(normal.getData());
-		tglVertex3fv(vertex.getData());
+			tglNormal3fv(model->_normals[index].getData());
+			tglVertex3fv(model->_drawVertices[index].getData());
+		}
 	}
 	tglEnd();
+	recordDraw(count);
 
 	if (!_currentShadowArray) {
 		tglColor3f(1.0f, 1.0f, 1.0f);
@@ -948,6 +948,7 @@ void GrimEngine::doFlip() {
 
 	if (_flipEnable)
 		g_driver->flipBuffer();
+	g_driver->endFrameStatistics();
 
 	if (_showFps && _mode != DrawMode) {
 		unsigned int currentTime = g_system->getMillis();
@@ -283,6 +283,7 @@ void Material::select() const {
 			t->_data = nullptr;
 		}
 		g_driver->selectTexture(t);
+		g_driver->recordTextureChange();
 	} else {
 		warning("Can't select material: %s", getFilename().c_str());
 	}
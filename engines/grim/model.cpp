@@ -381,6 +381,7 @@ void MeshFace::draw(const Mesh *mesh) const {
 
 	_material->select();
 	g_driver->drawModelFace(mesh, this);
+	g_driver->recordDraw(1);
 
 	if (_light == 0 && !g_driver->isShadowModeActive())
 		g_driver->enableLights();
@@ -25,6 +25,7 @@
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
 #include "engines/myst3/inventory.h"
+#include "engines/myst3/preloader.h"
 #include "engines/myst3/script.h"
 #include "engines/myst3/state.h"
 
@@ -43,6 +44,7 @@ Console::Console(Myst3Engine *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("fillInventory",			WRAP_METHOD(Console, Cmd_FillInventory));
 	registerCmd("dumpArchive",			WRAP_METHOD(Console, Cmd_DumpArchive));
 	registerCmd("dumpMasks",			WRAP_METHOD(Console, Cmd_DumpMasks));
+	registerCmd("preload",				WRAP_METHOD(Console, Cmd_Preload));
 }
 
 Console::~Console() {
@@ -476,4 +478,32 @@ bool Console::dumpFaceMask(uint16 index, int face, Archive::ResourceType type) {
 	return true;
 }
 
+bool Console::Cmd_Preload(int argc, const char **argv) {
+	NodePreloader *preloader = _vm->_nodePreloader;
+
+	if (argc == 2) {
+		if (!scumm_stricmp(argv[1], "compressed")) {
+			preloader->setKeepCompressed(true);
+		} else if (!scumm_stricmp(argv[1], "decoded")) {
+			preloader->setKeepCompressed(false);
+		} else if (!scumm_stricmp(argv[1], "clear")) {
+			preloader->clear();
+		} else {
+			debugPrintf("Usage :\n");
+			debugPrintf("preload : Display the node preloader statistics\n");
+			debugPrintf("preload compressed|decoded : Keep the preloaded faces compressed or decoded\n");
+			debugPrintf("preload clear : Free the preloaded faces\n");
+			return true;
+		}
+	}
+
+	debugPrintf("Preloaded faces are kept %s\n", preloader->getKeepCompressed() ? "compressed" : "decoded");
+	debugPrintf("Cached faces: %d (%d KB), pending: %d\n", preloader->getCachedFaceCount(),
+	            preloader->getCacheSize() / 1024, preloader->getPendingFaceCount());
+	debugPrintf("Loads: %d, hits: %d, misses: %d\n", preloader->getLoads(),
+	            preloader->getHits(), preloader->getMisses());
+
+	return true;
+}
+
 } // End of namespace Myst3
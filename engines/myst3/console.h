@@ -56,6 +56,7 @@ private:
 	bool Cmd_DumpArchive(int argc, const char **argv);
 	bool Cmd_DumpMasks(int argc, const char **argv);
 	bool Cmd_FillInventory(int argc, const char **argv);
+	bool Cmd_Preload(int argc, const char **argv);
 };
 
 } // End of namespace Myst3
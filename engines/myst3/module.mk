@@ -20,6 +20,7 @@ MODULE_OBJS := \
 	node.o \
 	nodecube.o \
 	nodeframe.o \
+	preloader.o \
 	puzzles.o \
 	scene.o \
 	script.o \
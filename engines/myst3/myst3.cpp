@@ -40,6 +40,7 @@
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
+#include "engines/myst3/preloader.h"
 #include "engines/myst3/scene.h"
 #include "engines/myst3/state.h"
 #include "engines/myst3/cursor.h"
@@ -67,7 +68,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_db(nullptr), _scriptEngine(nullptr),
 		_state(nullptr), _node(nullptr), _scene(nullptr), _archiveNode(nullptr),
 		_cursor(nullptr), _inventory(nullptr), _gfx(nullptr), _menu(nullptr),
-		_rnd(nullptr), _sound(nullptr), _ambient(nullptr),
+		_rnd(nullptr), _sound(nullptr), _ambient(nullptr), _nodePreloader(nullptr),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -113,6 +114,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _inventory;
 	delete _cursor;
 	delete _scene;
+	delete _nodePreloader;
 	delete _archiveNode;
 	delete _db;
 	delete _scriptEngine;
@@ -173,6 +175,7 @@ Common::Error Myst3Engine::run() {
 		_menu = new PagingMenu(this);
 	}
 	_archiveNode = new Archive();
+	_nodePreloader = new NodePreloader(this);
 
 	_system->showMouse(false);
 
@@ -180,6 +183,8 @@ Common::Error Myst3Engine::run() {
 	syncSoundSettings();
 	openArchives();
 
+	_nodePreloader->setKeepCompressed(ConfMan.getBool("preload_compressed"));
+
 	_cursor = new Cursor(this);
 	_inventory = new Inventory(this);
 
@@ -216,6 +221,7 @@ Common::Error Myst3Engine::run() {
 			_menuAction = 0;
 		}
 
+		_nodePreloader->update();
 		drawFrame();
 	}
 
@@ -872,6 +878,8 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	_shakeEffect = ShakeEffect::create(this);
 	_rotationEffect = RotationEffect::create(this);
 
+	_nodePreloader->queueAdjacentNodes();
+
 	// WORKAROUND: In Narayan, the scripts in node NACH 9 test on var 39
 	// without first reinitializing it leading to Saavedro not always giving
 	// Releeshan to the player when he is trapped between both shields.
@@ -1395,20 +1403,21 @@ Graphics::Surface *Myst3Engine::loadTexture(uint16 id) {
 
 Graphics::Surface *Myst3Engine::decodeJpeg(const ResourceDescription *jpegDesc) {
 	Common::SeekableReadStream *jpegStream = jpegDesc->getData();
+	Graphics::Surface *rgbaSurface = decodeJpeg(jpegStream);
+	delete jpegStream;
+
+	return rgbaSurface;
+}
 
+Graphics::Surface *Myst3Engine::decodeJpeg(Common::SeekableReadStream *jpegStream) {
 	Image::JPEGDecoder jpeg;
 	jpeg.setOutputPixelFormat(Texture::getRGBAPixelFormat());
 
-	if (!jpeg.loadStream(*jpegStream))
+	Graphics::Surface *rgbaSurface = new Graphics::Surface();
+	if (!jpeg.decodeInto(*jpegStream, *rgbaSurface))
 		error("Could not decode Myst III JPEG");
-	delete jpegStream;
 
-	const Graphics::Surface *bitmap = jpeg.getSurface();
-	assert(bitmap->format == Texture::getRGBAPixelFormat());
-
-	// JPEGDecoder owns the decoded surface, we have to make a copy...
-	Graphics::Surface *rgbaSurface = new Graphics::Surface();
-	rgbaSurface->copyFrom(*bitmap);
+	assert(rgbaSurface->format == Texture::getRGBAPixelFormat());
 	return rgbaSurface;
 }
 
@@ -1851,6 +1860,7 @@ void Myst3Engine::settingsInitDefaults() {
 	ConfMan.registerDefault("mouse_inverted", false);
 	ConfMan.registerDefault("zip_mode", false);
 	ConfMan.registerDefault("subtitles", false);
+	ConfMan.registerDefault("preload_compressed", false);
 	ConfMan.registerDefault("vibrations", true); // Xbox specific
 }
 
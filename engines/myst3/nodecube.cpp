@@ -22,6 +22,7 @@
 #include "engines/myst3/archive.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/myst3.h"
+#include "engines/myst3/preloader.h"
 
 #include "common/debug.h"
 
@@ -32,12 +33,19 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 	_is3D = true;
 
 	for (int i = 0; i < 6; i++) {
+		_faces[i] = new Face(_vm, true);
+
+		Graphics::Surface *bitmap = _vm->_nodePreloader->takeCubeFace(id, i + 1);
+		if (bitmap) {
+			_faces[i]->setTextureFromBitmap(bitmap);
+			continue;
+		}
+
 		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
 
 		if (!jpegDesc.isValid())
 			error("Face %d does not exist", id);
 
-		_faces[i] = new Face(_vm, true);
 		_faces[i]->setTextureFromJPEG(&jpegDesc);
 	}
 }
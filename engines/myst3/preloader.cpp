@@ -0,0 +1,229 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "engines/myst3/preloader.h"
+#include "engines/myst3/archive.h"
+#include "engines/myst3/database.h"
+#include "engines/myst3/hotspot.h"
+#include "engines/myst3/myst3.h"
+#include "engines/myst3/state.h"
+
+#include "common/debug.h"
+#include "common/stream.h"
+#include "common/system.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+NodePreloader::NodePreloader(Myst3Engine *vm) :
+		_vm(vm),
+		_cacheSize(0),
+		_useCounter(0),
+		_keepCompressed(false),
+		_hits(0),
+		_misses(0),
+		_loads(0) {
+}
+
+NodePreloader::~NodePreloader() {
+	clear();
+}
+
+Common::String NodePreloader::faceKey(const Common::String &room, uint16 nodeID, uint16 face) {
+	return Common::String::format("%s-%d-%d", room.c_str(), nodeID, face);
+}
+
+Common::String NodePreloader::currentRoomName() const {
+	return _vm->_db->getRoomName(_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+}
+
+void NodePreloader::queueAdjacentNodes() {
+	_pending.clear();
+
+	if (_vm->_state->getViewType() != kCube)
+		return;
+
+	uint16 currentNode = _vm->_state->getLocationNode();
+	NodePtr nodeData = _vm->_db->getNodeData(currentNode,
+			_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+	if (!nodeData)
+		return;
+
+	Common::String room = currentRoomName();
+
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size(); j++) {
+			const Opcode &opcode = script[j];
+			if (opcode.args.empty())
+				continue;
+
+			int32 target;
+			switch (opcode.op) {
+			case 136: // goToNodeTransition
+			case 137: // goToNodeTrans2
+			case 138: // goToNodeTrans1
+			case 140: // zipToNode
+				target = opcode.args[0];
+				break;
+			case 164: // changeNode
+				target = _vm->_state->valueOrVarValue(opcode.args[0]);
+				break;
+			default:
+				continue;
+			}
+
+			if (target > 0 && target != currentNode)
+				queueNode(room, target);
+		}
+	}
+}
+
+void NodePreloader::queueNode(const Common::String &room, uint16 nodeID) {
+	for (Common::List<PendingFace>::const_iterator it = _pending.begin(); it != _pending.end(); it++) {
+		if (it->node == nodeID)
+			return;
+	}
+
+	for (uint16 face = 1; face <= 6; face++) {
+		PendingFace pending;
+		pending.room = room;
+		pending.node = nodeID;
+		pending.face = face;
+		_pending.push_back(pending);
+	}
+}
+
+void NodePreloader::update() {
+	// A face load cannot be interrupted, so a frame may go over the budget
+	// by the time it takes to decode one face
+	uint32 startTime = g_system->getMillis();
+
+	while (!_pending.empty() && g_system->getMillis() - startTime < kFrameTimeBudget) {
+		PendingFace pending = _pending.front();
+		_pending.pop_front();
+
+		if (pending.room != currentRoomName())
+			continue; // The node archive of that room is no longer open
+
+		Common::String key = faceKey(pending.room, pending.node, pending.face);
+		FaceCache::iterator it = _cache.find(key);
+		if (it != _cache.end()) {
+			it->_value.lastUse = ++_useCounter;
+			continue;
+		}
+
+		loadFace(pending);
+	}
+}
+
+void NodePreloader::loadFace(const PendingFace &pending) {
+	ResourceDescription jpegDesc = _vm->getFileDescription(pending.room, pending.node, pending.face, Archive::kCubeFace);
+	if (!jpegDesc.isValid())
+		return; // Not a cube node
+
+	CachedFace cached;
+	Common::SeekableReadStream *jpegStream = jpegDesc.getData();
+	if (_keepCompressed) {
+		cached.jpegData = jpegStream;
+		cached.size = jpegStream->size();
+	} else {
+		cached.bitmap = Myst3Engine::decodeJpeg(jpegStream);
+		cached.size = cached.bitmap->pitch * cached.bitmap->h;
+		delete jpegStream;
+	}
+	cached.lastUse = ++_useCounter;
+
+	evict(cached.size);
+
+	_cache.setVal(faceKey(pending.room, pending.node, pending.face), cached);
+	_cacheSize += cached.size;
+	_loads++;
+
+	debugC(kDebugNode, "Preloaded face %d of node %d in room %s", pending.face, pending.node, pending.room.c_str());
+}
+
+Graphics::Surface *NodePreloader::takeCubeFace(uint16 nodeID, uint16 face) {
+	FaceCache::iterator it = _cache.find(faceKey(currentRoomName(), nodeID, face));
+	if (it == _cache.end()) {
+		_misses++;
+		return nullptr;
+	}
+
+	CachedFace cached = it->_value;
+	_cache.erase(it);
+	_cacheSize -= cached.size;
+	_hits++;
+
+	if (cached.bitmap)
+		return cached.bitmap;
+
+	Graphics::Surface *bitmap = Myst3Engine::decodeJpeg(cached.jpegData);
+	freeFace(cached);
+	return bitmap;
+}
+
+void NodePreloader::freeFace(CachedFace &cached) {
+	if (cached.bitmap) {
+		cached.bitmap->free();
+		delete cached.bitmap;
+		cached.bitmap = nullptr;
+	}
+
+	delete cached.jpegData;
+	cached.jpegData = nullptr;
+}
+
+void NodePreloader::evict(uint32 neededSize) {
+	while (!_cache.empty() && _cacheSize + neededSize > kMaxCacheSize) {
+		FaceCache::iterator oldest = _cache.begin();
+		for (FaceCache::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+		}
+
+		_cacheSize -= oldest->_value.size;
+		freeFace(oldest->_value);
+		_cache.erase(oldest);
+	}
+}
+
+void NodePreloader::clear() {
+	_pending.clear();
+
+	for (FaceCache::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		freeFace(it->_value);
+	}
+	_cache.clear();
+	_cacheSize = 0;
+}
+
+void NodePreloader::setKeepCompressed(bool keepCompressed) {
+	if (keepCompressed == _keepCompressed)
+		return;
+
+	clear();
+	_keepCompressed = keepCompressed;
+}
+
+} // End of namespace Myst3
@@ -0,0 +1,129 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MYST3_PRELOADER_H
+#define MYST3_PRELOADER_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/str.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Myst3 {
+
+class Myst3Engine;
+
+/**
+ * Loads the cube faces of the nodes the player can move to from the
+ * current node, so that they are ready when the player moves.
+ *
+ * The faces are loaded on the main thread between frames, for at most
+ * kFrameTimeBudget milliseconds per frame. They are either kept decoded,
+ * or, to save memory, as the original JPEG data which is decoded when the
+ * node is entered.
+ */
+class NodePreloader {
+public:
+	NodePreloader(Myst3Engine *vm);
+	~NodePreloader();
+
+	/**
+	 * Replaces the pending faces with those of the nodes reachable from
+	 * the current node, as found in the node's hotspot scripts
+	 */
+	void queueAdjacentNodes();
+
+	/** Loads pending faces until the time budget of the frame is spent */
+	void update();
+
+	/**
+	 * Returns a preloaded cube face of the current room, or nullptr if the
+	 * face has not been preloaded. The caller takes ownership of the surface.
+	 */
+	Graphics::Surface *takeCubeFace(uint16 nodeID, uint16 face);
+
+	void clear();
+
+	bool getKeepCompressed() const { return _keepCompressed; }
+	void setKeepCompressed(bool keepCompressed);
+
+	uint getHits() const { return _hits; }
+	uint getMisses() const { return _misses; }
+	uint getLoads() const { return _loads; }
+	uint getCachedFaceCount() const { return _cache.size(); }
+	uint getPendingFaceCount() const { return _pending.size(); }
+	uint32 getCacheSize() const { return _cacheSize; }
+
+private:
+	struct PendingFace {
+		Common::String room;
+		uint16 node;
+		uint16 face;
+	};
+
+	struct CachedFace {
+		/** The decoded face, unless only the JPEG data is kept */
+		Graphics::Surface *bitmap;
+		/** The JPEG data of the face, when it is kept compressed */
+		Common::SeekableReadStream *jpegData;
+		uint32 size;
+		uint32 lastUse;
+
+		CachedFace() : bitmap(nullptr), jpegData(nullptr), size(0), lastUse(0) {}
+	};
+
+	typedef Common::HashMap<Common::String, CachedFace> FaceCache;
+
+	static const uint32 kMaxCacheSize = 48 * 1024 * 1024;
+	static const uint32 kFrameTimeBudget = 4;
+
+	Myst3Engine *_vm;
+
+	Common::List<PendingFace> _pending;
+	FaceCache _cache;
+	uint32 _cacheSize;
+	uint32 _useCounter;
+	bool _keepCompressed;
+
+	uint _hits;
+	uint _misses;
+	uint _loads;
+
+	static Common::String faceKey(const Common::String &room, uint16 nodeID, uint16 face);
+	Common::String currentRoomName() const;
+
+	void queueNode(const Common::String &room, uint16 nodeID);
+	void loadFace(const PendingFace &pending);
+	void freeFace(CachedFace &cached);
+	void evict(uint32 neededSize);
+};
+
+} // End of namespace Myst3
+
+#endif // MYST3_PRELOADER_H
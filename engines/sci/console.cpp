@@ -32,6 +32,7 @@
 #include "sci/engine/selector.h"
 #include "sci/engine/savegame.h"
 #include "sci/engine/gc.h"
+#include "sci/engine/kpathing.h"
 #include "sci/engine/features.h"
 #include "sci/engine/scriptdebug.h"
 #include "sci/sound/midiparser_sci.h"
@@ -100,6 +101,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("selectors",			WRAP_METHOD(Console, cmdSelectors));
 	registerCmd("functions",			WRAP_METHOD(Console, cmdKernelFunctions));
 	registerCmd("class_table",		WRAP_METHOD(Console, cmdClassTable));
+	registerCmd("avoidpath_bench",	WRAP_METHOD(Console, cmdAvoidPathBench));
 	// Parser
 	registerCmd("suffixes",			WRAP_METHOD(Console, cmdSuffixes));
 	registerCmd("parse_grammar",		WRAP_METHOD(Console, cmdParseGrammar));
@@ -163,6 +165,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_mode",			WRAP_METHOD(Console, cmdGCMode));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -336,6 +340,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" selector - Attempts to find the requested selector by name\n");
 	debugPrintf(" functions - Lists the kernel functions\n");
 	debugPrintf(" class_table - Shows the available classes\n");
+	debugPrintf(" avoidpath_bench - Replays the recent AvoidPath queries with and without the visibility graph cache\n");
 	debugPrintf("\n");
 	debugPrintf("Parser:\n");
 	debugPrintf(" suffixes - Lists the vocabulary suffixes\n");
@@ -396,6 +401,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_mode - Shows or sets the garbage collection mode (full / incremental)\n");
+	debugPrintf(" gc_stats - Shows garbage collection pause statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -1696,6 +1703,61 @@ bool Console::cmdClassTable(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdAvoidPathBench(int argc, const char **argv) {
+	AvoidPathCache *cache = _engine->_gamestate->_avoidPathCache;
+
+	if (argc > 2) {
+		debugPrintf("Replays the most recent AvoidPath queries with and without the visibility graph cache.\n");
+		debugPrintf("Usage: %s [<iterations>]\n", argv[0]);
+		debugPrintf("       %s on|off - Enables or disables the cache\n", argv[0]);
+		debugPrintf("       %s record - Toggles recording of AvoidPath queries\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "record")) {
+		cache->setRecording(!cache->isRecording());
+		debugPrintf("AvoidPath query recording %s\n", cache->isRecording() ? "enabled" : "disabled");
+		return true;
+	}
+
+	if (argc == 2 && (!scumm_stricmp(argv[1], "on") || !scumm_stricmp(argv[1], "off"))) {
+		cache->setEnabled(!scumm_stricmp(argv[1], "on"));
+		debugPrintf("Visibility graph cache %s\n", cache->isEnabled() ? "enabled" : "disabled");
+		return true;
+	}
+
+	debugPrintf("Visibility graph cache: %s, %u graphs, %u hits, %u misses\n",
+		cache->isEnabled() ? "enabled" : "disabled", cache->getGraphCount(), cache->getHits(), cache->getMisses());
+
+	uint queries = cache->getRecordedQueries().size();
+	if (!queries) {
+		debugPrintf("No AvoidPath queries have been recorded yet, use '%s record' to record them\n", argv[0]);
+		return true;
+	}
+
+	int iterations = (argc == 2) ? atoi(argv[1]) : 10;
+	if (iterations <= 0) {
+		debugPrintf("Invalid number of iterations: %s\n", argv[1]);
+		return true;
+	}
+
+	bool wasEnabled = cache->isEnabled();
+	uint32 checksumUncached, checksumCached;
+
+	cache->setEnabled(false);
+	uint32 uncached = replayAvoidPathQueries(cache, iterations, checksumUncached);
+	cache->setEnabled(true);
+	uint32 cached = replayAvoidPathQueries(cache, iterations, checksumCached);
+	cache->setEnabled(wasEnabled);
+
+	debugPrintf("Replayed %u queries %d times\n", queries, iterations);
+	debugPrintf("Without cache: %u ms, with cache: %u ms\n", uncached, cached);
+	if (checksumUncached != checksumCached)
+		debugPrintf("WARNING: Paths differ between cached and uncached pathfinding!\n");
+
+	return true;
+}
+
 bool Console::cmdSentenceFragments(int argc, const char **argv) {
 	debugPrintf("Sentence fragments (used to build Parse trees)\n");
 
@@ -2745,7 +2807,66 @@ bool Console::cmdIsSample(int argc, const char **argv) {
 
 bool Console::cmdGCInvoke(int argc, const char **argv) {
 	debugPrintf("Performing garbage collection...\n");
-	run_gc(_engine->_gamestate);
+	_engine->_gamestate->_gc->collect();
+	debugPrintf("%u addresses freed\n", _engine->_gamestate->_gc->getStatistics().lastFreed);
+	return true;
+}
+
+bool Console::cmdGCMode(int argc, const char **argv) {
+	GarbageCollector *gc = _engine->_gamestate->_gc;
+
+	if (argc > 3) {
+		debugPrintf("Shows or sets the garbage collection mode.\n");
+		debugPrintf("Usage: %s [full | incremental] [<slice time in ms>]\n", argv[0]);
+		return true;
+	}
+
+	if (argc >= 2) {
+		if (!scumm_stricmp(argv[1], "full")) {
+			gc->setMode(kGCModeFull);
+		} else if (!scumm_stricmp(argv[1], "incremental")) {
+			gc->setMode(kGCModeIncremental);
+		} else {
+			debugPrintf("Unknown mode: %s\n", argv[1]);
+			return true;
+		}
+	}
+
+	if (argc == 3) {
+		int sliceTime = atoi(argv[2]);
+		if (sliceTime <= 0) {
+			debugPrintf("Invalid slice time: %s\n", argv[2]);
+			return true;
+		}
+		gc->setSliceTime(sliceTime);
+	}
+
+	debugPrintf("Garbage collection mode: %s, slice time: %u ms\n",
+		gc->getMode() == kGCModeIncremental ? "incremental" : "full", gc->getSliceTime());
+	if (gc->isMarking())
+		debugPrintf("Incremental cycle in progress, %u addresses pending\n", gc->getPendingCount());
+	return true;
+}
+
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GarbageCollector *gc = _engine->_gamestate->_gc;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		gc->resetStatistics();
+		debugPrintf("Garbage collection statistics reset\n");
+		return true;
+	}
+
+	const GCStatistics &stats = gc->getStatistics();
+
+	debugPrintf("Full collections: %u (%u incremental fallbacks)\n", stats.fullCollections, stats.fallbackCollections);
+	debugPrintf("Incremental cycles: %u, marking slices: %u, addresses marked in slices: %u\n",
+		stats.incrementalCycles, stats.slices, stats.objectsMarked);
+	debugPrintf("Pause: last %u ms, max %u ms, total %u ms, average %u ms\n",
+		stats.lastPause, stats.maxPause, stats.totalPause, stats.pauses ? stats.totalPause / stats.pauses : 0);
+	debugPrintf("Longest marking slice: %u ms (limit %u ms)\n", stats.maxSlice, gc->getSliceTime());
+	debugPrintf("Freed: last %u, total %u addresses\n", stats.lastFreed, stats.totalFreed);
+	debugPrintf("Use \"%s reset\" to reset the statistics\n", argv[0]);
 	return true;
 }
 
@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -67,6 +68,11 @@ void WorklistManager::pushArray(const Common::Array<reg_t> &tmp) {
 		push(*it);
 }
 
+void WorklistManager::clear() {
+	_worklist.clear();
+	_map.clear(true);
+}
+
 static AddrSet *normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_map) {
 	AddrSet *normal_map = new AddrSet();
 
@@ -98,10 +104,39 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 	}
 }
 
-AddrSet *findAllActiveReferences(EngineState *s) {
-	assert(!s->_executionStack.empty());
+/**
+ * Bounded variant of processWorkList(), which stops once endTime has been
+ * reached. Entries may have been freed by the scripts since they were queued,
+ * so they are validated before their references are listed.
+ * @return The number of processed entries
+ */
+static uint processWorkListSlice(SegManager *segMan, WorklistManager &wm, uint32 endTime) {
+	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
+	SegmentId stackSegment = segMan->findSegmentByType(SEG_TYPE_STACK);
+	uint count = 0;
 
-	WorklistManager wm;
+	while (!wm._worklist.empty()) {
+		// getMillis() is comparatively expensive, only poll it every few entries
+		if ((count & 63) == 63 && g_system->getMillis() >= endTime)
+			break;
+
+		reg_t reg = wm._worklist.back();
+		wm._worklist.pop_back();
+		count++;
+
+		if (reg.getSegment() == stackSegment || reg.getSegment() >= heap.size())
+			continue;
+
+		SegmentObj *mobj = heap[reg.getSegment()];
+		if (mobj && mobj->isValidOffset(reg.getOffset()))
+			wm.pushArray(mobj->listAllOutgoingReferences(reg));
+	}
+
+	return count;
+}
+
+static void pushRootSet(EngineState *s, WorklistManager &wm) {
+	assert(!s->_executionStack.empty());
 
 	// Initialize registers
 	wm.push(s->r_acc);
@@ -169,8 +204,13 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	}
 
 	debugC(kDebugLevelGC, "[GC] -- Finished explicitly loaded scripts, done with root set");
+}
 
-	processWorkList(s->_segMan, wm, heap);
+AddrSet *findAllActiveReferences(EngineState *s) {
+	WorklistManager wm;
+
+	pushRootSet(s, wm);
+	processWorkList(s->_segMan, wm, s->_segMan->getSegments());
 
 	if (g_sci->_gfxPorts)
 		g_sci->_gfxPorts->processEngineHunkList(wm);
@@ -178,11 +218,10 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
-void run_gc(EngineState *s) {
-	SegManager *segMan = s->_segMan;
+static uint sweep(SegManager *segMan, const AddrSet &activeRefs) {
+	uint freed = 0;
 
 	// Some debug stuff
-	debugC(kDebugLevelGC, "[GC] Running...");
 #ifdef GC_DEBUG_CODE
 	const char *segnames[SEG_TYPE_MAX + 1];
 	int segcount[SEG_TYPE_MAX + 1];
@@ -190,9 +229,6 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
-	// Compute the set of all segments references currently in use.
-	AddrSet *activeRefs = findAllActiveReferences(s);
-
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
 	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
@@ -210,10 +246,11 @@ void run_gc(EngineState *s) {
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
-				if (!activeRefs->contains(addr)) {
+				if (!activeRefs.contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
+					freed++;
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
 #endif
@@ -223,8 +260,6 @@ void run_gc(EngineState *s) {
 		}
 	}
 
-	delete activeRefs;
-
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -232,6 +267,153 @@ void run_gc(EngineState *s) {
 		if (segcount[i])
 			debugC(kDebugLevelGC, "\t%d\t* %s", segcount[i], segnames[i]);
 #endif
+
+	return freed;
+}
+
+uint run_gc(EngineState *s) {
+	debugC(kDebugLevelGC, "[GC] Running...");
+
+	// Compute the set of all segments references currently in use.
+	AddrSet *activeRefs = findAllActiveReferences(s);
+
+	uint freed = sweep(s->_segMan, *activeRefs);
+
+	delete activeRefs;
+
+	return freed;
+}
+
+void GCStatistics::reset() {
+	fullCollections = 0;
+	incrementalCycles = 0;
+	fallbackCollections = 0;
+	pauses = 0;
+	slices = 0;
+	objectsMarked = 0;
+	lastPause = 0;
+	maxPause = 0;
+	totalPause = 0;
+	maxSlice = 0;
+	lastFreed = 0;
+	totalFreed = 0;
+}
+
+void GCStatistics::recordPause(uint32 pause) {
+	pauses++;
+	lastPause = pause;
+	maxPause = MAX(maxPause, pause);
+	totalPause += pause;
+}
+
+void GCStatistics::recordFreed(uint freed) {
+	lastFreed = freed;
+	totalFreed += freed;
+}
+
+GarbageCollector::GarbageCollector(EngineState *s) :
+	_state(s),
+	_mode(kGCModeFull),
+	_sliceTime(2),
+	_marking(false) {
+}
+
+void GarbageCollector::setMode(GCMode mode) {
+	if (mode != kGCModeIncremental)
+		cancel();
+	_mode = mode;
+}
+
+void GarbageCollector::trigger() {
+	if (_mode == kGCModeFull)
+		collect();
+	else if (!_marking)
+		startCycle();
+	else
+		finishCycle();
+}
+
+void GarbageCollector::collect() {
+	cancel();
+
+	uint32 startTime = g_system->getMillis();
+	uint freed = run_gc(_state);
+	_stats.fullCollections++;
+	_stats.recordPause(g_system->getMillis() - startTime);
+	_stats.recordFreed(freed);
+}
+
+void GarbageCollector::cancel() {
+	if (_marking) {
+		debugC(kDebugLevelGC, "[GC] Aborting incremental cycle");
+		_state->_segMan->setGCWriteBarrier(false);
+		_wm.clear();
+		_marking = false;
+	}
+}
+
+void GarbageCollector::startCycle() {
+	uint32 startTime = g_system->getMillis();
+
+	debugC(kDebugLevelGC, "[GC] Starting incremental cycle");
+	_wm.clear();
+	pushRootSet(_state, _wm);
+	_state->_segMan->setGCWriteBarrier(true);
+	_marking = true;
+
+	_stats.recordPause(g_system->getMillis() - startTime);
+}
+
+void GarbageCollector::step() {
+	if (!_marking || _wm._worklist.empty())
+		return;
+
+	uint32 startTime = g_system->getMillis();
+	_stats.objectsMarked += processWorkListSlice(_state->_segMan, _wm, startTime + _sliceTime);
+	_stats.slices++;
+	_stats.maxSlice = MAX(_stats.maxSlice, g_system->getMillis() - startTime);
+}
+
+void GarbageCollector::finishCycle() {
+	SegManager *segMan = _state->_segMan;
+
+	if (segMan->getGCHeapChanged()) {
+		// Segments have been freed (and possibly reused) since the cycle
+		// started, so marked addresses may be stale. Start over.
+		debugC(kDebugLevelGC, "[GC] Heap layout changed during incremental cycle");
+		_stats.fallbackCollections++;
+		collect();
+		return;
+	}
+
+	uint32 startTime = g_system->getMillis();
+
+	// Remark: anything that is reachable now, but has not been marked, must
+	// be referenced from the roots or from an address in a segment that has
+	// been written to since the cycle started.
+	for (AddrSet::const_iterator i = _wm._map.begin(); i != _wm._map.end(); ++i) {
+		if (segMan->isGCDirty(i->_key.getSegment()))
+			_wm._worklist.push_back(i->_key);
+	}
+	segMan->setGCWriteBarrier(false);
+
+	pushRootSet(_state, _wm);
+	processWorkListSlice(segMan, _wm, 0xFFFFFFFF);
+
+	if (g_sci->_gfxPorts)
+		g_sci->_gfxPorts->processEngineHunkList(_wm);
+
+	AddrSet *activeRefs = normalizeAddresses(segMan, _wm._map);
+	_wm.clear();
+	_marking = false;
+
+	uint freed = sweep(segMan, *activeRefs);
+	delete activeRefs;
+
+	_stats.incrementalCycles++;
+	_stats.recordPause(g_system->getMillis() - startTime);
+	_stats.recordFreed(freed);
+	debugC(kDebugLevelGC, "[GC] Finished incremental cycle, %u addresses freed", freed);
 }
 
 } // End of namespace Sci
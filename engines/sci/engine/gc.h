@@ -51,8 +51,9 @@ AddrSet *findAllActiveReferences(EngineState *s);
 /**
  * Runs garbage collection on the current system state
  * @param s The state in which we should gc
+ * @return The number of deallocated addresses
  */
-void run_gc(EngineState *s);
+uint run_gc(EngineState *s);
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
@@ -60,6 +61,105 @@ struct WorklistManager {
 
 	void push(reg_t reg);
 	void pushArray(const Common::Array<reg_t> &tmp);
+	void clear();
+};
+
+enum GCMode {
+	kGCModeFull = 0,       ///< Stop-the-world mark and sweep whenever the GC is triggered
+	kGCModeIncremental = 1 ///< Marking is spread over time slices, only the final remark and sweep is atomic
+};
+
+/**
+ * Pause and throughput statistics of the garbage collector, shown by the
+ * "gc_stats" console command. All times are in milliseconds.
+ */
+struct GCStatistics {
+	uint32 fullCollections;      ///< Stop-the-world collections (including fallbacks)
+	uint32 incrementalCycles;    ///< Completed incremental cycles
+	uint32 fallbackCollections;  ///< Incremental cycles that had to be redone stop-the-world
+	uint32 pauses;               ///< Atomic phases (full collections, cycle starts and ends)
+	uint32 slices;               ///< Incremental marking slices executed
+	uint32 objectsMarked;        ///< Addresses marked by incremental slices
+	uint32 lastPause;
+	uint32 maxPause;
+	uint32 totalPause;
+	uint32 maxSlice;
+	uint32 lastFreed;
+	uint32 totalFreed;
+
+	GCStatistics() { reset(); }
+	void reset();
+	void recordPause(uint32 pause);
+	void recordFreed(uint freed);
+};
+
+/**
+ * Drives garbage collection for an EngineState.
+ *
+ * In full mode, every trigger runs run_gc(). In incremental mode, a trigger
+ * only snapshots the root set; the reachable graph is then marked in
+ * bounded slices from EngineState::speedThrottler(), i.e. once per frame.
+ * While a cycle is in progress the SegManager write barrier records every
+ * segment that may have received a new reference. The cycle is completed at
+ * the next kernel call after marking has drained (or when the next trigger
+ * arrives), by rescanning the roots and the marked addresses of all dirty
+ * segments and then sweeping. If segments were freed while marking, the
+ * cycle falls back to a full collection.
+ */
+class GarbageCollector {
+public:
+	GarbageCollector(EngineState *s);
+
+	GCMode getMode() const { return _mode; }
+	void setMode(GCMode mode);
+
+	/** Maximum time in ms spent in a single marking slice */
+	uint32 getSliceTime() const { return _sliceTime; }
+	void setSliceTime(uint32 sliceTime) { _sliceTime = sliceTime; }
+
+	/**
+	 * Called by the VM when the GC countdown expires. Runs a full collection,
+	 * or starts (or forcibly completes) an incremental cycle.
+	 */
+	void trigger();
+
+	/**
+	 * Runs a full collection right away, discarding any incremental cycle
+	 * in progress.
+	 */
+	void collect();
+
+	/** Performs a bounded marking slice, if an incremental cycle is in progress */
+	void step();
+
+	/**
+	 * Completes the current incremental cycle, if all its marking is done.
+	 * Must only be called between kernel calls.
+	 */
+	void finishIfReady() {
+		if (_marking && _wm._worklist.empty())
+			finishCycle();
+	}
+
+	/** Discards any incremental cycle in progress without freeing anything */
+	void cancel();
+
+	bool isMarking() const { return _marking; }
+	uint getPendingCount() const { return _wm._worklist.size(); }
+
+	const GCStatistics &getStatistics() const { return _stats; }
+	void resetStatistics() { _stats.reset(); }
+
+private:
+	void startCycle();
+	void finishCycle();
+
+	EngineState *_state;
+	GCMode _mode;
+	uint32 _sliceTime;
+	bool _marking;
+	WorklistManager _wm;
+	GCStatistics _stats;
 };
 
 
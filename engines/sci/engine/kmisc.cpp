@@ -190,7 +190,7 @@ reg_t kMemorySegment(EngineState *s, int argc, reg_t *argv) {
 }
 
 reg_t kFlushResources(EngineState *s, int argc, reg_t *argv) {
-	run_gc(s);
+	s->_gc->collect();
 	debugC(kDebugLevelRoom, "Entering room number %d", argv[0].toUint16());
 	return s->r_acc;
 }
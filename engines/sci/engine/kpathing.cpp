@@ -23,6 +23,7 @@
 #include "sci/engine/state.h"
 #include "sci/engine/selector.h"
 #include "sci/engine/kernel.h"
+#include "sci/engine/kpathing.h"
 #include "sci/graphics/paint16.h"
 #include "sci/graphics/palette.h"
 #include "sci/graphics/screen.h"
@@ -116,10 +117,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Index in the cached visibility graph, or -1 if not part of it
+	int graphIndex;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = nullptr;
+		graphIndex = -1;
 	}
 };
 
@@ -241,11 +246,48 @@ public:
 
 typedef Common::List<Polygon *> PolygonList;
 
+// Maximum number of vertices of a polygon set for which the visibility
+// graph is cached (the graph takes up the square of this in bytes)
+#define VISIBILITY_GRAPH_MAX_VERTICES 512
+
+// Number of visibility graphs kept in the AvoidPathCache
+#define VISIBILITY_GRAPH_CACHE_SIZE 4
+
+// Number of kAvoidPath queries recorded for the avoidpath_bench command
+#define AVOIDPATH_RECORDED_QUERIES 64
+
+/**
+ * Visibility between the vertices of a polygon set. A row is filled in the
+ * first time A* expands the corresponding vertex.
+ */
+struct VisibilityGraph {
+	// The serialized polygon set
+	Common::Array<int16> key;
+	uint32 hash;
+
+	// Number of vertices
+	uint size;
+
+	// Per row: has the row been computed yet?
+	Common::Array<byte> rowComputed;
+
+	// size * size visibility flags
+	Common::Array<byte> visible;
+
+	VisibilityGraph(const Common::Array<int16> &k, uint32 h, uint n) : key(k), hash(h), size(n) {
+		rowComputed.resize(n);
+		visible.resize(n * n);
+	}
+};
+
 // Pathfinding state
 struct PathfindingState {
 	// List of all polygons
 	PolygonList polygons;
 
+	// Cached visibility graph of the polygons, or NULL
+	VisibilityGraph *_graph;
+
 	// Start and end points for pathfinding
 	Vertex *vertex_start, *vertex_end;
 
@@ -263,6 +305,7 @@ struct PathfindingState {
 	int _width, _height;
 
 	PathfindingState(int width, int height) : _width(width), _height(height) {
+		_graph = nullptr;
 		vertex_start = nullptr;
 		vertex_end = nullptr;
 		vertex_index = nullptr;
@@ -698,6 +741,65 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether a vertex is visible from another vertex
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if the line between both vertices doesn't intersect a polygon
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Returns the row of the cached visibility graph for a vertex, computing it
+ * if necessary. Vertices that have been merged into the polygon set after the
+ * graph was set up have no edges, so they don't affect the visibility between
+ * the vertices of the graph.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex, which must be part of the graph
+ * @return the visibility flags of all graph vertices, as seen from vertex_cur
+ */
+static const byte *visibility_row(PathfindingState *s, Vertex *vertex_cur) {
+	VisibilityGraph *graph = s->_graph;
+	byte *row = &graph->visible[vertex_cur->graphIndex * graph->size];
+
+	if (!graph->rowComputed[vertex_cur->graphIndex]) {
+		for (int i = 0; i < s->vertices; i++) {
+			Vertex *vertex = s->vertex_index[i];
+			if (vertex->graphIndex >= 0)
+				row[vertex->graphIndex] = is_visible(s, vertex_cur, vertex);
+		}
+
+		graph->rowComputed[vertex_cur->graphIndex] = 1;
+	}
+
+	return row;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -706,34 +808,21 @@ static int inside(const Common::Point &p, Vertex *vertex) {
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	const byte *row = nullptr;
+
+	if (s->_graph && vertex_cur->graphIndex >= 0)
+		row = visibility_row(s, vertex_cur);
 
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
+		bool visible;
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
-
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
-
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
-		}
+		if (row && vertex->graphIndex >= 0)
+			visible = row[vertex->graphIndex];
+		else
+			visible = is_visible(s, vertex_cur, vertex);
 
-		if (j == s->vertices)
+		if (visible)
 			visVerts->push_front(vertex);
 	}
 
@@ -1249,40 +1338,71 @@ static void change_polygons_opt_0(PathfindingState *s) {
 }
 
 /**
- * Converts the SCI input data for pathfinding
- * Parameters: (EngineState *) s: The game state
- *             (reg_t) poly_list: Polygon list
- *             (Common::Point) start: The start point
- *             (Common::Point) end: The end point
- *             (int) opt: Optimization level (0, 1 or 2)
- * Returns   : (PathfindingState *) On success a newly allocated pathfinding state,
- *                            NULL otherwise
+ * Serializes a polygon set. The result identifies the polygon set and
+ * can be turned back into polygons with deserialize_polygons().
+ * Parameters: (const PolygonList &) polygons: The polygons to serialize
+ *             (Common::Array<int16> &) out: Receives the type, vertex count
+ *                                           and points of each polygon
+ * Returns   : (uint) The total number of vertices
  */
-static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Common::Point start, Common::Point end, int width, int height, int opt) {
-	SegManager *segMan = s->_segMan;
-	Polygon *polygon;
-	int count = 0;
-	PathfindingState *pf_s = new PathfindingState(width, height);
-
-	// Convert all polygons
-	if (poly_list.getSegment()) {
-		List *list = s->_segMan->lookupList(poly_list);
-		Node *node = s->_segMan->lookupNode(list->first);
+static uint serialize_polygons(const PolygonList &polygons, Common::Array<int16> &out) {
+	uint vertexCount = 0;
 
-		while (node) {
-			// The node value might be null, in which case there's no polygon to parse.
-			// Happens in LB2 floppy - refer to bug #5195
-			polygon = !node->value.isNull() ? convert_polygon(s, node->value) : nullptr;
+	for (PolygonList::const_iterator it = polygons.begin(); it != polygons.end(); ++it) {
+		const Polygon *polygon = *it;
+		Vertex *vertex;
 
-			if (polygon) {
-				pf_s->polygons.push_back(polygon);
-				count += readSelectorValue(segMan, node->value, SELECTOR(size));
-			}
+		out.push_back(polygon->type);
+		uint countPos = out.size();
+		out.push_back(0);
 
-			node = s->_segMan->lookupNode(node->succ);
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			out.push_back(vertex->v.x);
+			out.push_back(vertex->v.y);
+			out[countPos]++;
 		}
+
+		vertexCount += out[countPos];
 	}
 
+	return vertexCount;
+}
+
+static void deserialize_polygons(const Common::Array<int16> &data, PolygonList &polygons) {
+	uint pos = 0;
+
+	while (pos + 1 < data.size()) {
+		Polygon *polygon = new Polygon(data[pos]);
+		int size = data[pos + 1];
+		pos += 2;
+
+		for (int i = 0; i < size; i++, pos += 2)
+			polygon->vertices.insertAtEnd(new Vertex(Common::Point(data[pos], data[pos + 1])));
+
+		polygons.push_back(polygon);
+	}
+}
+
+/**
+ * Prepares a pathfinding state, whose polygons have been set up already, for
+ * pathfinding between two points
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) pf_s: The pathfinding state
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ *             (AvoidPathCache *) cache: Visibility graph cache, or NULL
+ *             (const Common::Array<int16> *) inputKey: The polygons of pf_s
+ *                                  as serialized by the caller, or NULL
+ *             (uint) inputVertexCount: Number of vertices in inputKey
+ * Returns   : (PathfindingState *) On success pf_s, NULL otherwise. On
+ *                                  failure, pf_s is deleted.
+ */
+static PathfindingState *prepare_polygon_set(EngineState *s, PathfindingState *pf_s, Common::Point start, Common::Point end, int opt, AvoidPathCache *cache,
+		const Common::Array<int16> *inputKey, uint inputVertexCount) {
+	Polygon *polygon;
+	const uint inputPolygons = pf_s->polygons.size();
+
 	if (opt == 0)
 		change_polygons_opt_0(pf_s);
 
@@ -1339,6 +1459,34 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	// Look up the visibility graph of the polygons as they are now, before
+	// the start and end points get merged in
+	if (cache && cache->isEnabled()) {
+		// Fixing up the start and end points only ever removes polygons, so
+		// the caller's serialization is still valid if none were removed
+		if (inputKey && pf_s->polygons.size() == inputPolygons) {
+			pf_s->_graph = cache->getGraph(*inputKey, inputVertexCount);
+		} else {
+			Common::Array<int16> key;
+			uint count = serialize_polygons(pf_s->polygons, key);
+
+			pf_s->_graph = cache->getGraph(key, count);
+		}
+
+		if (pf_s->_graph) {
+			int index = 0;
+
+			for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it) {
+				polygon = *it;
+				Vertex *vertex;
+
+				CLIST_FOREACH(vertex, &polygon->vertices) {
+					vertex->graphIndex = index++;
+				}
+			}
+		}
+	}
+
 	// Merge start and end points into polygon set
 	pf_s->vertex_start = merge_point(pf_s, *new_start);
 	pf_s->vertex_end = merge_point(pf_s, *new_end);
@@ -1346,8 +1494,19 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	delete new_start;
 	delete new_end;
 
+	// If the start or end point split a polygon edge, the visibility between
+	// the existing vertices may have changed, so the graph can't be used
+	if ((pf_s->vertex_start->graphIndex < 0 && VERTEX_HAS_EDGES(pf_s->vertex_start)) ||
+	    (pf_s->vertex_end->graphIndex < 0 && VERTEX_HAS_EDGES(pf_s->vertex_end)))
+		pf_s->_graph = nullptr;
+
 	// Allocate and build vertex index
-	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * (count + 2));
+	int count = 0;
+
+	for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it)
+		count += (*it)->vertices.size();
+
+	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * count);
 
 	count = 0;
 
@@ -1365,6 +1524,58 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	return pf_s;
 }
 
+/**
+ * Converts the SCI input data for pathfinding
+ * Parameters: (EngineState *) s: The game state
+ *             (reg_t) poly_list: Polygon list
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ * Returns   : (PathfindingState *) On success a newly allocated pathfinding state,
+ *                            NULL otherwise
+ */
+static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Common::Point start, Common::Point end, int width, int height, int opt) {
+	Polygon *polygon;
+	PathfindingState *pf_s = new PathfindingState(width, height);
+
+	// Convert all polygons
+	if (poly_list.getSegment()) {
+		List *list = s->_segMan->lookupList(poly_list);
+		Node *node = s->_segMan->lookupNode(list->first);
+
+		while (node) {
+			// The node value might be null, in which case there's no polygon to parse.
+			// Happens in LB2 floppy - refer to bug #5195
+			polygon = !node->value.isNull() ? convert_polygon(s, node->value) : nullptr;
+
+			if (polygon)
+				pf_s->polygons.push_back(polygon);
+
+			node = s->_segMan->lookupNode(node->succ);
+		}
+	}
+
+	AvoidPathCache *cache = s->_avoidPathCache;
+	if (!cache->isEnabled() && !cache->isRecording())
+		return prepare_polygon_set(s, pf_s, start, end, opt, cache, nullptr, 0);
+
+	Common::Array<int16> key;
+	uint vertexCount = serialize_polygons(pf_s->polygons, key);
+
+	if (cache->isRecording()) {
+		AvoidPathQuery query;
+		query.polygons = key;
+		query.start = start;
+		query.end = end;
+		query.width = width;
+		query.height = height;
+		query.opt = opt;
+		cache->recordQuery(query);
+	}
+
+	return prepare_polygon_set(s, pf_s, start, end, opt, cache, &key, vertexCount);
+}
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1657,6 +1868,104 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 	}
 }
 
+AvoidPathCache::AvoidPathCache() : _enabled(true), _recording(false), _hits(0), _misses(0) {
+}
+
+bool AvoidPathCache::isRecording() const {
+	return _recording || DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath);
+}
+
+AvoidPathCache::~AvoidPathCache() {
+	clear();
+}
+
+void AvoidPathCache::clear() {
+	for (Common::List<VisibilityGraph *>::iterator it = _graphs.begin(); it != _graphs.end(); ++it)
+		delete *it;
+
+	_graphs.clear();
+}
+
+void AvoidPathCache::setEnabled(bool enabled) {
+	_enabled = enabled;
+
+	if (!enabled)
+		clear();
+}
+
+VisibilityGraph *AvoidPathCache::getGraph(const Common::Array<int16> &key, uint vertexCount) {
+	if (!_enabled || vertexCount > VISIBILITY_GRAPH_MAX_VERTICES)
+		return nullptr;
+
+	uint32 hash = 0;
+	for (uint i = 0; i < key.size(); i++)
+		hash = hash * 31 + (uint16)key[i];
+
+	for (Common::List<VisibilityGraph *>::iterator it = _graphs.begin(); it != _graphs.end(); ++it) {
+		VisibilityGraph *graph = *it;
+
+		if (graph->hash == hash && graph->key == key) {
+			_graphs.erase(it);
+			_graphs.push_front(graph);
+			_hits++;
+			return graph;
+		}
+	}
+
+	_misses++;
+
+	if (_graphs.size() >= VISIBILITY_GRAPH_CACHE_SIZE) {
+		delete _graphs.back();
+		_graphs.pop_back();
+	}
+
+	VisibilityGraph *graph = new VisibilityGraph(key, hash, vertexCount);
+	_graphs.push_front(graph);
+	return graph;
+}
+
+void AvoidPathCache::recordQuery(const AvoidPathQuery &query) {
+	if (_queries.size() >= AVOIDPATH_RECORDED_QUERIES)
+		_queries.pop_front();
+
+	_queries.push_back(query);
+}
+
+uint32 replayAvoidPathQueries(AvoidPathCache *cache, uint iterations, uint32 &checksum) {
+	EngineState *s = g_sci->getEngineState();
+	const Common::List<AvoidPathQuery> &queries = cache->getRecordedQueries();
+	uint32 startTime = g_system->getMillis();
+
+	checksum = 0;
+
+	for (uint i = 0; i < iterations; i++) {
+		for (Common::List<AvoidPathQuery>::const_iterator it = queries.begin(); it != queries.end(); ++it) {
+			const AvoidPathQuery &query = *it;
+			PathfindingState *p = new PathfindingState(query.width, query.height);
+
+			deserialize_polygons(query.polygons, p->polygons);
+
+			uint vertexCount = 0;
+			for (PolygonList::const_iterator pit = p->polygons.begin(); pit != p->polygons.end(); ++pit)
+				vertexCount += (*pit)->vertices.size();
+
+			p = prepare_polygon_set(s, p, query.start, query.end, query.opt, cache, &query.polygons, vertexCount);
+
+			if (!p)
+				continue;
+
+			AStar(p);
+
+			for (Vertex *vertex = p->vertex_end; vertex; vertex = vertex->path_prev)
+				checksum = checksum * 31 + ((uint16)vertex->v.x << 16 | (uint16)vertex->v.y);
+
+			delete p;
+		}
+	}
+
+	return g_system->getMillis() - startTime;
+}
+
 static bool PointInRect(const Common::Point &point, int16 rectX1, int16 rectY1, int16 rectX2, int16 rectY2) {
 	int16 top = MIN<int16>(rectY1, rectY2);
 	int16 left = MIN<int16>(rectX1, rectX2);
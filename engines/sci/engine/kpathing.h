@@ -0,0 +1,114 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SCI_ENGINE_KPATHING_H
+#define SCI_ENGINE_KPATHING_H
+
+#include "common/array.h"
+#include "common/list.h"
+#include "common/rect.h"
+
+namespace Sci {
+
+struct VisibilityGraph;
+
+/**
+ * A kAvoidPath query, as recorded for the avoidpath_bench console command.
+ */
+struct AvoidPathQuery {
+	/** The input polygons: type, vertex count and points of each polygon */
+	Common::Array<int16> polygons;
+	Common::Point start;
+	Common::Point end;
+	int width;
+	int height;
+	int opt;
+};
+
+/**
+ * Cache of the visibility graphs of the polygon sets passed to kAvoidPath.
+ *
+ * Scripts usually call kAvoidPath many times for the same room polygons,
+ * with only the start and end points changing. The visibility between the
+ * polygon vertices only depends on the polygons, so it is computed once per
+ * polygon set and reused; only the start and end points are linked to the
+ * graph on each call.
+ */
+class AvoidPathCache {
+public:
+	AvoidPathCache();
+	~AvoidPathCache();
+
+	void clear();
+
+	bool isEnabled() const { return _enabled; }
+	void setEnabled(bool enabled);
+
+	/**
+	 * Queries are only recorded for the avoidpath_bench console command
+	 * while recording is switched on, or the Pathfinding debug channel is
+	 * enabled.
+	 */
+	bool isRecording() const;
+	void setRecording(bool recording) { _recording = recording; }
+
+	/**
+	 * Returns the visibility graph for the given serialized polygon set,
+	 * creating an empty one if it is not cached yet. Returns nullptr if the
+	 * polygon set is too large to be cached, or if the cache is disabled.
+	 */
+	VisibilityGraph *getGraph(const Common::Array<int16> &key, uint vertexCount);
+
+	void recordQuery(const AvoidPathQuery &query);
+	const Common::List<AvoidPathQuery> &getRecordedQueries() const { return _queries; }
+
+	uint getHits() const { return _hits; }
+	uint getMisses() const { return _misses; }
+	uint getGraphCount() const { return _graphs.size(); }
+
+	void resetStatistics() { _hits = _misses = 0; }
+
+private:
+	/** Cached graphs, most recently used first */
+	Common::List<VisibilityGraph *> _graphs;
+
+	/** The most recent queries, oldest first */
+	Common::List<AvoidPathQuery> _queries;
+
+	bool _enabled;
+	bool _recording;
+	uint _hits;
+	uint _misses;
+};
+
+/**
+ * Runs all queries recorded by the cache through the pathfinder.
+ * @param cache      The cache holding the recorded queries. It is used for
+ *                   the replay if it is enabled.
+ * @param iterations Number of times to replay every query
+ * @param checksum   Receives a checksum over all resulting paths
+ * @return The time spent in ms
+ */
+uint32 replayAvoidPathQueries(AvoidPathCache *cache, uint iterations, uint32 &checksum);
+
+} // End of namespace Sci
+
+#endif // SCI_ENGINE_KPATHING_H
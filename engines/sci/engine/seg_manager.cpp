@@ -31,7 +31,7 @@ namespace Sci {
 
 
 SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
-	: _resMan(resMan), _scriptPatcher(scriptPatcher) {
+	: _resMan(resMan), _scriptPatcher(scriptPatcher), _gcBarrierActive(false), _gcHeapChanged(false) {
 	_heap.push_back(0);
 
 	_clonesSegId = 0;
@@ -125,6 +125,8 @@ SegmentObj *SegManager::allocSegment(SegmentObj *mem, SegmentId *segid) {
 	}
 	_heap[id] = mem;
 
+	gcWriteBarrier(id);
+
 	return mem;
 }
 
@@ -145,6 +147,26 @@ Script *SegManager::allocateScript(int script_nr, SegmentId *segid) {
 	return (Script *)mem;
 }
 
+void SegManager::setGCWriteBarrier(bool active) {
+	_gcBarrierActive = active;
+	_gcHeapChanged = false;
+	_gcDirtySegments.clear();
+	if (active)
+		_gcDirtySegments.resize(_heap.size());
+}
+
+void SegManager::markGCDirty(SegmentId seg) const {
+	SegmentId actualSegment = getActualSegment(seg);
+	if (actualSegment >= _gcDirtySegments.size())
+		_gcDirtySegments.resize(actualSegment + 1);
+	_gcDirtySegments[actualSegment] = true;
+}
+
+bool SegManager::isGCDirty(SegmentId seg) const {
+	SegmentId actualSegment = getActualSegment(seg);
+	return actualSegment < _gcDirtySegments.size() && _gcDirtySegments[actualSegment];
+}
+
 SegmentId SegManager::getActualSegment(SegmentId seg) const {
 	if (getSciVersion() <= SCI_VERSION_2_1_LATE) {
 		return seg;
@@ -163,6 +185,9 @@ void SegManager::deallocate(SegmentId seg) {
 	if (!mobj)
 		error("Attempt to deallocate an already freed segment");
 
+	if (_gcBarrierActive)
+		_gcHeapChanged = true;
+
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
@@ -247,6 +272,9 @@ Object *SegManager::getObject(reg_t pos) const {
 	Object *obj = nullptr;
 
 	if (mobj != nullptr) {
+		// Callers may write to the returned object
+		gcWriteBarrier(pos.getSegment());
+
 		if (mobj->getType() == SEG_TYPE_CLONES) {
 			CloneTable &ct = *(CloneTable *)mobj;
 			if (ct.isValidEntry(pos.getOffset()))
@@ -538,6 +566,7 @@ List *SegManager::lookupList(reg_t addr) {
 	}
 
 	ListTable &lt = *(ListTable *)_heap[addr.getSegment()];
+	gcWriteBarrier(addr.getSegment());
 
 	if (!lt.isValidEntry(addr.getOffset())) {
 		error("Attempt to use non-list %04x:%04x as list", PRINT_REG(addr));
@@ -559,6 +588,7 @@ Node *SegManager::lookupNode(reg_t addr, bool stopOnDiscarded) {
 	}
 
 	NodeTable &nt = *(NodeTable *)_heap[addr.getSegment()];
+	gcWriteBarrier(addr.getSegment());
 
 	if (!nt.isValidEntry(addr.getOffset())) {
 		if (!stopOnDiscarded)
@@ -581,6 +611,7 @@ SegmentRef SegManager::dereference(reg_t pointer) {
 	}
 
 	SegmentObj *mobj = _heap[pointer.getSegment()];
+	gcWriteBarrier(pointer.getSegment());
 	return mobj->dereference(pointer);
 }
 
@@ -961,6 +992,8 @@ SciArray *SegManager::lookupArray(reg_t addr) {
 	if (!arrayTable.isValidEntry(addr.getOffset()))
 		error("Attempt to use non-array %04x:%04x as array", PRINT_REG(addr));
 
+	gcWriteBarrier(addr.getSegment());
+
 	return &(arrayTable[addr.getOffset()]);
 }
 
@@ -462,6 +462,44 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	// Incremental garbage collection, see GarbageCollector
+
+	/**
+	 * Enables or disables the write barrier. Enabling it clears the set of
+	 * dirty segments and the heap change flag.
+	 */
+	void setGCWriteBarrier(bool active);
+
+	/**
+	 * Records that references inside the given segment may have been
+	 * modified. Must be called before any reference is stored in a segment
+	 * through a pointer that was not obtained from the SegManager, like the
+	 * cached variable pointers of the VM.
+	 */
+	void gcWriteBarrier(SegmentId seg) const {
+		if (_gcBarrierActive)
+			markGCDirty(seg);
+	}
+
+	/**
+	 * Checks whether references in the given segment may have been modified
+	 * since the write barrier was enabled.
+	 */
+	bool isGCDirty(SegmentId seg) const;
+
+	/**
+	 * Checks whether any segment has been deallocated since the write
+	 * barrier was enabled.
+	 */
+	bool getGCHeapChanged() const { return _gcHeapChanged; }
+
+private:
+	void markGCDirty(SegmentId seg) const;
+
+	bool _gcBarrierActive;
+	bool _gcHeapChanged;
+	mutable Common::Array<bool> _gcDirtySegments;
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
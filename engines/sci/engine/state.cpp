@@ -24,8 +24,10 @@
 #include "sci/debug.h"	// for g_debug_sleeptime_factor
 #include "sci/engine/features.h"
 #include "sci/engine/file.h"
+#include "sci/engine/gc.h"
 #include "sci/engine/guest_additions.h"
 #include "sci/engine/kernel.h"
+#include "sci/engine/kpathing.h"
 #include "sci/engine/state.h"
 #include "sci/engine/selector.h"
 #include "sci/engine/vm.h"
@@ -70,11 +72,16 @@ EngineState::EngineState(SegManager *segMan)
 : _segMan(segMan),
 	_dirseeker() {
 
+	_gc = new GarbageCollector(this);
+	_avoidPathCache = new AvoidPathCache();
+
 	reset(false);
 }
 
 EngineState::~EngineState() {
 	delete _msgState;
+	delete _gc;
+	delete _avoidPathCache;
 }
 
 void EngineState::reset(bool isRestoring) {
@@ -103,6 +110,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	_gc->cancel();
 
 #ifdef ENABLE_SCI32
 	_eventCounter = 0;
@@ -124,6 +132,10 @@ void EngineState::reset(bool isRestoring) {
 }
 
 void EngineState::speedThrottler(uint32 neededSleep) {
+	// Give the incremental garbage collector its slice of this frame. Time
+	// spent here is deducted from the sleep below.
+	_gc->step();
+
 	if (_throttleTrigger) {
 		uint32 curTime = g_system->getMillis();
 		uint32 duration = curTime - _throttleLastTime;
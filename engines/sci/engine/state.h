@@ -42,9 +42,11 @@ class WriteStream;
 
 namespace Sci {
 
+class AvoidPathCache;
 class FileHandle;
 class DirSeeker;
 class EventManager;
+class GarbageCollector;
 class MessageState;
 class SoundCommandParser;
 class VirtualIndexFile;
@@ -194,6 +196,9 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GarbageCollector *_gc; /**< The garbage collector, see gc.h */
+
+	AvoidPathCache *_avoidPathCache; /**< Visibility graphs of kAvoidPath polygon sets, see kpathing.h */
 
 	MessageState *_msgState;
 
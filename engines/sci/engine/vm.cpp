@@ -198,6 +198,7 @@ static void write_var(EngineState *s, int type, int index, reg_t value) {
 		if (type == VAR_TEMP && value.getSegment() == kUninitializedSegment)
 			value.setSegment(0);
 
+		s->_segMan->gcWriteBarrier(s->variablesSegment[type]);
 		s->variables[type][index] = value;
 
 		g_sci->_guestAdditions->writeVarHook(type, index, value);
@@ -884,7 +885,9 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				s->_gc->trigger();
+			} else {
+				s->_gc->finishIfReady();
 			}
 
 			// Call kernel function
@@ -1151,6 +1154,7 @@ void run_vm(EngineState *s) {
 				                    s->_segMan, BREAK_SELECTORWRITE);
 			}
 
+			s->_segMan->gcWriteBarrier(s->xs->objp.getSegment());
 			opProperty = s->r_acc;
 #ifdef ENABLE_SCI32
 			updateInfoFlagViewVisible(obj, opparams[0], true);
@@ -1181,6 +1185,7 @@ void run_vm(EngineState *s) {
 				                    opProperty, newValue,
 				                    s->_segMan, BREAK_SELECTORWRITE);
 			}
+			s->_segMan->gcWriteBarrier(s->xs->objp.getSegment());
 			opProperty = newValue;
 #ifdef ENABLE_SCI32
 			updateInfoFlagViewVisible(obj, opparams[0], true);
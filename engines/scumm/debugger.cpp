@@ -20,6 +20,7 @@
  */
 
 #include "common/debug-channels.h"
+#include "common/algorithm.h"
 #include "common/file.h"
 #include "common/str.h"
 #include "common/system.h"
@@ -78,6 +79,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("script",    WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	registerCmd("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
+	registerCmd("profile",   WRAP_METHOD(ScummDebugger, Cmd_Profile));
 	registerCmd("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
 
 	if (_vm->_game.id == GID_LOOM)
@@ -102,6 +104,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 #endif
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+	registerCmd("benchgfx",  WRAP_METHOD(ScummDebugger, Cmd_BenchGfx));
 }
 
 void ScummDebugger::preEnter() {
@@ -524,6 +527,95 @@ bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	return true;
 }
 
+namespace {
+
+struct ScriptProfileEntry {
+	uint32 key;
+	uint32 runs;
+	uint32 opcodes;
+	uint32 millis;
+};
+
+bool scriptProfileEntryLess(const ScriptProfileEntry &a, const ScriptProfileEntry &b) {
+	if (a.millis != b.millis)
+		return a.millis > b.millis;
+	return a.opcodes > b.opcodes;
+}
+
+struct OpcodeProfileEntry {
+	byte opcode;
+	uint32 count;
+};
+
+bool opcodeProfileEntryLess(const OpcodeProfileEntry &a, const OpcodeProfileEntry &b) {
+	return a.count > b.count;
+}
+
+} // End of anonymous namespace
+
+bool ScummDebugger::Cmd_Profile(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Syntax: profile <on | off | reset | scripts [count] | opcodes [count]>\n");
+		debugPrintf("Script profiling is %s\n", _vm->_scriptProfiling ? "on" : "off");
+		return true;
+	}
+
+	int count = (argc > 2) ? atoi(argv[2]) : 20;
+
+	if (!strcmp(argv[1], "on")) {
+		_vm->_scriptProfiling = true;
+	} else if (!strcmp(argv[1], "off")) {
+		_vm->_scriptProfiling = false;
+	} else if (!strcmp(argv[1], "reset")) {
+		_vm->resetScriptProfile();
+	} else if (!strcmp(argv[1], "scripts")) {
+		Common::Array<ScriptProfileEntry> entries;
+		uint32 totalOpcodes = 0;
+		for (ScummEngine::ScriptProfileMap::const_iterator i = _vm->_scriptProfile.begin(); i != _vm->_scriptProfile.end(); ++i) {
+			ScriptProfileEntry entry;
+			entry.key = i->_key;
+			entry.runs = i->_value.runs;
+			entry.opcodes = i->_value.opcodes;
+			entry.millis = i->_value.millis;
+			entries.push_back(entry);
+			totalOpcodes += i->_value.opcodes;
+		}
+		Common::sort(entries.begin(), entries.end(), scriptProfileEntryLess);
+
+		debugPrintf("+-----+---+--------+----------+--------+\n");
+		debugPrintf("|  num|whr|    runs|   opcodes| time ms|\n");
+		debugPrintf("+-----+---+--------+----------+--------+\n");
+		for (uint i = 0; i < entries.size() && (int)i < count; i++) {
+			const ScriptProfileEntry &entry = entries[i];
+			debugPrintf("|%5d|%3d|%8d|%10d|%8d|\n",
+					entry.key & 0xFFFF, entry.key >> 16, entry.runs,
+					entry.opcodes, entry.millis);
+		}
+		debugPrintf("+-----+---+--------+----------+--------+\n");
+		debugPrintf("%d scripts, %d opcodes\n", entries.size(), totalOpcodes);
+	} else if (!strcmp(argv[1], "opcodes")) {
+		Common::Array<OpcodeProfileEntry> entries;
+		for (int i = 0; i < 256; i++) {
+			if (_vm->_opcodeProfile[i]) {
+				OpcodeProfileEntry entry;
+				entry.opcode = i;
+				entry.count = _vm->_opcodeProfile[i];
+				entries.push_back(entry);
+			}
+		}
+		Common::sort(entries.begin(), entries.end(), opcodeProfileEntryLess);
+
+		for (uint i = 0; i < entries.size() && (int)i < count; i++) {
+			const char *desc = _vm->getOpcodeDesc(entries[i].opcode);
+			debugPrintf("[%02X] %10d %s\n", entries[i].opcode, entries[i].count, desc ? desc : "");
+		}
+	} else {
+		debugPrintf("Unknown profile command '%s'\n", argv[1]);
+	}
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_Actor(int argc, const char **argv) {
 	Actor *a;
 	int actnum;
@@ -1034,4 +1126,39 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_BenchGfx(int argc, const char **argv) {
+	int iterations = (argc > 1) ? atoi(argv[1]) : 100;
+	if (iterations <= 0) {
+		debugPrintf("Syntax: benchgfx [iterations]\n");
+		return true;
+	}
+
+	VirtScreen *vs = &_vm->_virtscr[kMainVirtScreen];
+	if (!_vm->_roomResource || vs->h == 0) {
+		debugPrintf("No room loaded\n");
+		return true;
+	}
+
+	// Decode all visible strips of the current room, as when scrolling or
+	// entering the room, and compose them with the text surface
+	uint32 startTime = g_system->getMillis();
+	for (int i = 0; i < iterations; i++)
+		_vm->redrawBGStrip(0, _vm->_gdi->_numStrips);
+	uint32 decodeTime = g_system->getMillis() - startTime;
+
+	startTime = g_system->getMillis();
+	for (int i = 0; i < iterations; i++)
+		_vm->drawStripToScreen(vs, 0, vs->w, 0, vs->h);
+	uint32 composeTime = g_system->getMillis() - startTime;
+
+	debugPrintf("Room %d, %d strips of %d lines, %d iterations\n", _vm->_roomResource, _vm->_gdi->_numStrips, vs->h, iterations);
+	debugPrintf("Strip decoding: %d ms total, %d us per frame\n", decodeTime, decodeTime * 1000 / iterations);
+	debugPrintf("Composition:    %d ms total, %d us per frame\n", composeTime, composeTime * 1000 / iterations);
+
+	// Leave the screen in a consistent state
+	_vm->_fullRedraw = true;
+
+	return true;
+}
+
 } // End of namespace Scumm
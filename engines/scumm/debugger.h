@@ -54,6 +54,7 @@ private:
 	bool Cmd_Object(int argc, const char **argv);
 	bool Cmd_Script(int argc, const char **argv);
 	bool Cmd_PrintScript(int argc, const char **argv);
+	bool Cmd_Profile(int argc, const char **argv);
 	bool Cmd_ImportRes(int argc, const char **argv);
 
 	bool Cmd_PrintDraft(int argc, const char **argv);
@@ -68,6 +69,7 @@ private:
 	bool Cmd_DiMuse(int argc, const char **argv);
 
 	bool Cmd_ResetCursors(int argc, const char **argv);
+	bool Cmd_BenchGfx(int argc, const char **argv);
 
 	void printBox(int box);
 	void drawBox(int box);
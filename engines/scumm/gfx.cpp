@@ -33,6 +33,14 @@
 #include "scumm/he/wiz_he.h"
 #include "scumm/util.h"
 
+#if !defined(USE_ARM_GFX_ASM)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif
+
 #ifdef USE_ARM_GFX_ASM
 
 #ifndef IPHONE
@@ -53,6 +61,9 @@ static void fill(byte *dst, int dstPitch, uint16 color, int w, int h, uint8 bitD
 static void copy8Col(byte *dst, int dstPitch, const byte *src, int height, uint8 bitDepth);
 #endif
 static void clear8Col(byte *dst, int dstPitch, int height, uint8 bitDepth);
+#ifndef USE_ARM_GFX_ASM
+static void compositeTextRow(byte *dst, const byte *src, const byte *text, int width);
+#endif
 
 static void ditherHerc(byte *src, byte *hercbuf, int srcPitch, int *x, int *y, int *width, int *height);
 
@@ -701,35 +712,16 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 #ifdef USE_ARM_GFX_ASM
 			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
 #else
-			// We blit four pixels at a time, for improved performance.
-			const uint32 *src32 = (const uint32 *)src;
-			uint32 *dst32 = (uint32 *)_compositeBuf;
-
-			vsPitch >>= 2;
+			const byte *src8 = (const byte *)src;
+			const byte *text8 = (const byte *)text;
+			byte *dst8 = _compositeBuf;
+			const int rowWidth = width * m;
 
-			const uint32 *text32 = (const uint32 *)text;
-			const int textPitch = (_textSurface.pitch - width * m) >> 2;
 			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
-					uint32 temp = *text32++;
-
-					// Generate a byte mask for those text pixels (bytes) with
-					// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
-					// in mask will be either equal to 0x00 or 0xFF.
-					// Doing it this way avoids branches and bytewise operations,
-					// at the cost of readability ;).
-					uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
-					mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
-					mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
-
-					// The following line is equivalent to this code:
-					//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
-					// However, some compilers can generate somewhat better
-					// machine code for this equivalent statement:
-					*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
-				}
-				src32 += vsPitch;
-				text32 += textPitch;
+				compositeTextRow(dst8, src8, text8, rowWidth);
+				dst8 += rowWidth;
+				src8 += rowWidth + vsPitch;
+				text8 += _textSurface.pitch;
 			}
 #endif
 		}
@@ -1256,6 +1248,53 @@ static void copy8Col(byte *dst, int dstPitch, const byte *src, int height, uint8
 
 #endif /* USE_ARM_GFX_ASM */
 
+#ifndef USE_ARM_GFX_ASM
+
+/**
+ * Composes a row of the text surface over a row of 8bpp game graphics: text
+ * pixels with value CHARSET_MASK_TRANSPARENCY let the graphics show through.
+ * The width must be a multiple of 4.
+ */
+static void compositeTextRow(byte *dst, const byte *src, const byte *text, int width) {
+	int w = 0;
+
+#if defined(__SSE2__)
+	const __m128i transparent = _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY);
+	for (; w + 16 <= width; w += 16) {
+		const __m128i t = _mm_loadu_si128((const __m128i *)(text + w));
+		const __m128i s = _mm_loadu_si128((const __m128i *)(src + w));
+		const __m128i mask = _mm_cmpeq_epi8(t, transparent);
+		_mm_storeu_si128((__m128i *)(dst + w), _mm_or_si128(_mm_and_si128(mask, s), _mm_andnot_si128(mask, t)));
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t transparent = vdupq_n_u8(CHARSET_MASK_TRANSPARENCY);
+	for (; w + 16 <= width; w += 16) {
+		const uint8x16_t t = vld1q_u8(text + w);
+		const uint8x16_t s = vld1q_u8(src + w);
+		vst1q_u8(dst + w, vbslq_u8(vceqq_u8(t, transparent), s, t));
+	}
+#endif
+
+	// Handle the remaining pixels four at a time
+	for (; w < width; w += 4) {
+		const uint32 temp = READ_UINT32(text + w);
+
+		// Generate a byte mask for those text pixels (bytes) with
+		// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
+		// in mask will be either equal to 0x00 or 0xFF.
+		// Doing it this way avoids branches and bytewise operations,
+		// at the cost of readability ;).
+		uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+		mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+		mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+
+		// This is equivalent to (src & mask) | (temp & ~mask)
+		WRITE_UINT32(dst + w, ((temp ^ READ_UINT32(src + w)) & mask) ^ temp);
+	}
+}
+
+#endif /* USE_ARM_GFX_ASM */
+
 static void clear8Col(byte *dst, int dstPitch, int height, uint8 bitDepth) {
 	do {
 #if defined(SCUMM_NEED_ALIGNMENT)
@@ -1868,6 +1907,7 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		limit = numstrip;
 	if (limit > _numStrips - sx)
 		limit = _numStrips - sx;
+	const int firstStripX = x;
 	for (int k = 0; k < limit; ++k, ++stripnr, ++sx, ++x) {
 		if (y < vs->tdirty[sx])
 			vs->tdirty[sx] = y;
@@ -1888,14 +1928,6 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
 			transpStrip = true;
 
-		if (vs->hasTwoBuffers) {
-			byte *frontBuf = (byte *)vs->getBasePtr(x * 8, y);
-			if (lightsOn)
-				copy8Col(frontBuf, vs->pitch, dstPtr, height, vs->format.bytesPerPixel);
-			else
-				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
-		}
-
 		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
 
 #if 0
@@ -1922,6 +1954,20 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		}
 #endif
 	}
+
+	// The strips were decoded to the back buffer. Copy them to the front
+	// buffer in one go rather than strip by strip, so that each row is a
+	// single wide copy instead of many 8 pixel ones.
+	if (vs->hasTwoBuffers && limit > 0) {
+		const uint8 bitDepth = vs->format.bytesPerPixel;
+		byte *frontBuf = (byte *)vs->getBasePtr(firstStripX * 8, y);
+		if (lightsOn) {
+			const byte *backBuf = vs->backBuf + y * vs->pitch + firstStripX * 8 * bitDepth;
+			blit(frontBuf, vs->pitch, backBuf, vs->pitch, limit * 8, height, bitDepth);
+		} else {
+			fill(frontBuf, vs->pitch, (_vm->_game.platform == Common::kPlatformNES) ? 0x1d : 0, limit * 8, height, bitDepth);
+		}
+	}
 }
 
 bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
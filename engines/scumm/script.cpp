@@ -334,7 +334,11 @@ void ScummEngine::runScriptNested(int script) {
 	_currentScript = script;
 	getScriptBaseAddress();
 	resetScriptPointer();
-	executeScript();
+
+	if (_scriptProfiling)
+		executeScriptProfiled();
+	else
+		executeScript();
 
 	if (vm.numNestedScripts != 0)
 		vm.numNestedScripts--;
@@ -441,18 +445,16 @@ void ScummEngine::resetScriptPointer() {
 }
 
 /**
- * This method checks whether the resource that contains the active script
- * moved, and if so, updates the script pointer accordingly.
+ * Updates the script pointer after the resource that contains the active
+ * script moved. See refreshScriptPointer().
  *
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::relocateScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
@@ -482,19 +484,52 @@ void ScummEngine::executeScript() {
 			debugN("\n");
 		}
 
+		if (_scriptProfiling) {
+			_opcodeProfile[_opcode]++;
+			_scriptOpcodeCount++;
+		}
+
 		executeOpcode(_opcode);
 
 	}
 }
 
+/**
+ * Executes the current script like executeScript, and adds the run to the
+ * script profile. Opcodes are attributed to the script that executes them,
+ * while the time includes all scripts run nested from this one.
+ */
+void ScummEngine::executeScriptProfiled() {
+	uint32 key = (vm.slot[_currentScript].where << 16) | vm.slot[_currentScript].number;
+	uint32 outerOpcodeCount = _scriptOpcodeCount;
+	uint32 startTime = _system->getMillis();
+
+	_scriptOpcodeCount = 0;
+	executeScript();
+
+	// Nested scripts may have added entries to the profile in the meantime,
+	// so the entry is only looked up now
+	ScriptProfile &profile = _scriptProfile[key];
+	profile.runs++;
+	profile.opcodes += _scriptOpcodeCount;
+	profile.millis += _system->getMillis() - startTime;
+	_scriptOpcodeCount = outerOpcodeCount;
+}
+
 void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
+	OpcodeProc proc = _opcodes[i].proc;
+	if (proc)
+		(this->*proc)();
 	else {
 		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 	}
 }
 
+void ScummEngine::resetScriptProfile() {
+	_scriptProfile.clear();
+	memset(_opcodeProfile, 0, sizeof(_opcodeProfile));
+}
+
 const char *ScummEngine::getOpcodeDesc(byte i) {
 #ifndef REDUCE_MEMORY_USAGE
 	return _opcodes[i].desc;
@@ -503,11 +538,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
@@ -940,7 +970,10 @@ void ScummEngine::runAllScripts() {
 				_currentScript = (byte)i;
 				getScriptBaseAddress();
 				resetScriptPointer();
-				executeScript();
+				if (_scriptProfiling)
+					executeScriptProfiled();
+				else
+					executeScript();
 			}
 		}
 	}
@@ -155,6 +155,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	memset(_localScriptOffsets, 0, sizeof(_localScriptOffsets));
 	vm.numNestedScripts = 0;
 	memset(_vmStack, 0, sizeof(_vmStack));
+	memset(_opcodeProfile, 0, sizeof(_opcodeProfile));
 	memset(_resourceMapper, 0, sizeof(_resourceMapper));
 	memset(_sentence, 0, sizeof(_sentence));
 	memset(_string, 0, sizeof(_string));
@@ -27,6 +27,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/mutex.h"
@@ -599,6 +600,28 @@ protected:
 	bool _showStack = false;
 	bool _debugMode = false;
 
+	/** Statistics of a single script, collected while script profiling is on */
+	struct ScriptProfile {
+		/** Number of times the script was run or resumed */
+		uint32 runs;
+		/** Number of opcodes executed by the script itself */
+		uint32 opcodes;
+		/** Time spent in the script, including nested scripts, in ms */
+		uint32 millis;
+
+		ScriptProfile() : runs(0), opcodes(0), millis(0) {}
+	};
+
+	/** Script profile, indexed by (where << 16) | script number */
+	typedef Common::HashMap<uint32, ScriptProfile> ScriptProfileMap;
+
+	bool _scriptProfiling = false;
+	ScriptProfileMap _scriptProfile;
+	uint32 _opcodeProfile[256];
+	uint32 _scriptOpcodeCount = 0;
+
+	void resetScriptProfile();
+
 	// Save/Load class - some of this may be GUI
 	byte _saveLoadFlag = 0, _saveLoadSlot = 0;
 	uint32 _lastSaveTime = 0;
@@ -655,6 +678,34 @@ protected:
 	int _scummStackPos = 0;
 	int _vmStack[256];
 
+	/**
+	 * Opcode handlers are called directly through member function pointers,
+	 * which avoids the virtual call of a functor object per opcode. The
+	 * handlers are member functions of the subclasses, converted to
+	 * ScummEngine member pointers by the OPCODE macros of each script_*.cpp.
+	 */
+	typedef void (ScummEngine::*OpcodeProc)();
+
+	struct OpcodeEntry {
+		OpcodeProc proc;
+#ifndef REDUCE_MEMORY_USAGE
+		const char *desc;
+#endif
+
+#ifndef REDUCE_MEMORY_USAGE
+		OpcodeEntry() : proc(nullptr), desc(nullptr) {}
+#else
+		OpcodeEntry() : proc(nullptr) {}
+#endif
+
+		void setProc(OpcodeProc p, const char *d) {
+			proc = p;
+#ifndef REDUCE_MEMORY_USAGE
+			desc = d;
+#endif
+		}
+	};
+
 	OpcodeEntry _opcodes[256];
 
 	virtual void setupOpcodes() = 0;
@@ -676,6 +727,7 @@ protected:
 	void runObjectScript(int script, int entry, bool freezeResistant, bool recursive, int *vars, int slot = -1, int cycle = 0);
 	void runScriptNested(int script);
 	void executeScript();
+	void executeScriptProfiled();
 	void updateScriptPtr();
 	virtual void runInventoryScript(int i);
 	void inventoryScriptIndy3Mac();
@@ -702,8 +754,20 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	/**
+	 * Checks whether the resource that contains the active script moved,
+	 * and if so, updates the script pointer accordingly. This is called for
+	 * every byte fetched from a script, so only the check is inlined.
+	 */
+	void refreshScriptPointer() {
+		if (*_lastCodePtr != _scriptOrgPointer)
+			relocateScriptPointer();
+	}
+	void relocateScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
 	uint fetchScriptDWord();
@@ -26,6 +26,12 @@
 #include "scumm/bomp.h"
 #include "scumm/smush/codec47.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Scumm {
 
 #if defined(SCUMM_NEED_ALIGNMENT)
@@ -55,13 +61,16 @@ namespace Scumm {
 
 #endif
 
+// Copy and fill whole block rows with single, possibly unaligned, 32 and
+// 64 bit memory accesses. The fill values are replicated over all bytes.
+#define COPY_8X1_LINE(dst, src)			\
+	WRITE_UINT64(dst, READ_UINT64(src))
+
+#define FILL_8X1_LINE(dst, val)			\
+	WRITE_UINT64(dst, val)
+
 #define FILL_4X1_LINE(dst, val)			\
-	do {					\
-		(dst)[0] = val;	\
-		(dst)[1] = val;	\
-		(dst)[2] = val;	\
-		(dst)[3] = val;	\
-	} while (0)
+	WRITE_UINT32(dst, val)
 
 #define FILL_2X1_LINE(dst, val)			\
 	do {					\
@@ -69,6 +78,9 @@ namespace Scumm {
 		(dst)[1] = val;	\
 	} while (0)
 
+#define REPLICATE_4X(val)	((uint32)(val) * 0x01010101U)
+#define REPLICATE_8X(val)	((uint64)(val) * 0x0101010101010101ULL)
+
 static const  int8 codec47_table_small1[] = {
   0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0, 0, 1, 2, 2, 1,
 };
@@ -262,6 +274,9 @@ void Codec47Decoder::makeTablesInterpolation(int param) {
 			}
 
 			if (param == 8) {
+				byte *mask = _maskBig + (s / 388) * 64;
+				for (i = 0; i < 64; i++)
+					mask[i] = tableSmallBig[i] ? 0xFF : 0;
 				for (i = 64 - 1; i >= 0; i--) {
 					if (tableSmallBig[i] != 0) {
 						_tableBig[256 + s + _tableBig[384 + s]] = (byte)i;
@@ -274,6 +289,9 @@ void Codec47Decoder::makeTablesInterpolation(int param) {
 				s += 388;
 			}
 			if (param == 4) {
+				byte *mask = _maskSmall + (s / 128) * 16;
+				for (i = 0; i < 16; i++)
+					mask[i] = tableSmallBig[i] ? 0xFF : 0;
 				for (i = 16 - 1; i >= 0; i--) {
 					if (tableSmallBig[i] != 0) {
 						_tableSmall[64 + s + _tableSmall[96 + s]] = (byte)i;
@@ -359,6 +377,50 @@ extern "C" void ARM_Smush_decode2(      byte  *dst,
 				   _offset1,_offset2,_tableSmall)
 
 #else
+
+// Draw a two colour pattern block: every pixel takes the first colour where
+// its mask byte is set and the second one elsewhere.
+static inline void drawPattern8x8(byte *dst, int pitch, const byte *mask, byte c1, byte c2) {
+#if defined(__SSE2__)
+	const __m128i v1 = _mm_set1_epi8((char)c1);
+	const __m128i v2 = _mm_set1_epi8((char)c2);
+	for (int i = 0; i < 4; i++) {
+		const __m128i m = _mm_loadu_si128((const __m128i *)(mask + i * 16));
+		const __m128i rows = _mm_or_si128(_mm_and_si128(m, v1), _mm_andnot_si128(m, v2));
+		_mm_storel_epi64((__m128i *)dst, rows);
+		_mm_storel_epi64((__m128i *)(dst + pitch), _mm_unpackhi_epi64(rows, rows));
+		dst += pitch * 2;
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t v1 = vdupq_n_u8(c1);
+	const uint8x16_t v2 = vdupq_n_u8(c2);
+	for (int i = 0; i < 4; i++) {
+		const uint8x16_t rows = vbslq_u8(vld1q_u8(mask + i * 16), v1, v2);
+		vst1_u8(dst, vget_low_u8(rows));
+		vst1_u8(dst + pitch, vget_high_u8(rows));
+		dst += pitch * 2;
+	}
+#else
+	const uint64 v1 = REPLICATE_8X(c1);
+	const uint64 v2 = REPLICATE_8X(c2);
+	for (int i = 0; i < 8; i++) {
+		const uint64 m = READ_UINT64(mask + i * 8);
+		FILL_8X1_LINE(dst, (m & v1) | (~m & v2));
+		dst += pitch;
+	}
+#endif
+}
+
+static inline void drawPattern4x4(byte *dst, int pitch, const byte *mask, byte c1, byte c2) {
+	const uint32 v1 = REPLICATE_4X(c1);
+	const uint32 v2 = REPLICATE_4X(c2);
+	for (int i = 0; i < 4; i++) {
+		const uint32 m = READ_UINT32(mask + i * 4);
+		FILL_4X1_LINE(dst, (m & v1) | (~m & v2));
+		dst += pitch;
+	}
+}
+
 void Codec47Decoder::level3(byte *d_dst) {
 	int32 tmp;
 	byte code = *_d_src++;
@@ -406,27 +468,15 @@ void Codec47Decoder::level2(byte *d_dst) {
 		d_dst += 2;
 		level3(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		uint32 t = REPLICATE_4X(*_d_src++);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFD) {
-		byte *tmp_ptr = _tableSmall + *_d_src++ * 128;
-		int32 l = tmp_ptr[96];
-		byte val = *_d_src++;
-		int16 *tmp_ptr2 = (int16 *)tmp_ptr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmp_ptr2)) = val;
-			tmp_ptr2++;
-		}
-		l = tmp_ptr[97];
-		val = *_d_src++;
-		tmp_ptr2 = (int16 *)(tmp_ptr + 32);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmp_ptr2)) = val;
-			tmp_ptr2++;
-		}
+		const byte *mask = _maskSmall + *_d_src++ * 16;
+		drawPattern4x4(d_dst, _d_pitch, mask, _d_src[0], _d_src[1]);
+		_d_src += 2;
 	} else if (code == 0xFC) {
 		tmp = _offset2;
 		for (i = 0; i < 4; i++) {
@@ -434,7 +484,7 @@ void Codec47Decoder::level2(byte *d_dst) {
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint32 t = REPLICATE_4X(_paramPtr[code]);
 		for (i = 0; i < 4; i++) {
 			FILL_4X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
@@ -443,15 +493,14 @@ void Codec47Decoder::level2(byte *d_dst) {
 }
 
 void Codec47Decoder::level1(byte *d_dst) {
-	int32 tmp, tmp2;
+	int32 tmp;
 	byte code = *_d_src++;
 	int i;
 
 	if (code < 0xF8) {
-		tmp2 = _table[code] + _offset1;
+		tmp = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFF) {
@@ -463,41 +512,25 @@ void Codec47Decoder::level1(byte *d_dst) {
 		d_dst += 4;
 		level2(d_dst);
 	} else if (code == 0xFE) {
-		byte t = *_d_src++;
+		uint64 t = REPLICATE_8X(*_d_src++);
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	} else if (code == 0xFD) {
-		tmp = *_d_src++;
-		byte *tmp_ptr = _tableBig + tmp * 388;
-		byte l = tmp_ptr[384];
-		byte val = *_d_src++;
-		int16 *tmp_ptr2 = (int16 *)tmp_ptr;
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmp_ptr2)) = val;
-			tmp_ptr2++;
-		}
-		l = tmp_ptr[385];
-		val = *_d_src++;
-		tmp_ptr2 = (int16 *)(tmp_ptr + 128);
-		while (l--) {
-			*(d_dst + READ_LE_UINT16(tmp_ptr2)) = val;
-			tmp_ptr2++;
-		}
+		const byte *mask = _maskBig + *_d_src++ * 64;
+		drawPattern8x8(d_dst, _d_pitch, mask, _d_src[0], _d_src[1]);
+		_d_src += 2;
 	} else if (code == 0xFC) {
-		tmp2 = _offset2;
+		tmp = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp2);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp2 + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _d_pitch;
 		}
 	} else {
-		byte t = _paramPtr[code];
+		uint64 t = REPLICATE_8X(_paramPtr[code]);
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _d_pitch;
 		}
 	}
@@ -528,7 +561,9 @@ Codec47Decoder::Codec47Decoder(int width, int height) {
 	_height = height;
 	_tableBig = (byte *)malloc(256 * 388);
 	_tableSmall = (byte *)malloc(256 * 128);
-	if ((_tableBig != nullptr) && (_tableSmall != nullptr)) {
+	_maskBig = (byte *)malloc(256 * 64);
+	_maskSmall = (byte *)malloc(256 * 16);
+	if ((_tableBig != nullptr) && (_tableSmall != nullptr) && (_maskBig != nullptr) && (_maskSmall != nullptr)) {
 		makeTablesInterpolation(4);
 		makeTablesInterpolation(8);
 	}
@@ -550,6 +585,10 @@ Codec47Decoder::~Codec47Decoder() {
 		free(_tableSmall);
 		_tableSmall = nullptr;
 	}
+	free(_maskBig);
+	_maskBig = nullptr;
+	free(_maskSmall);
+	_maskSmall = nullptr;
 	_lastTableWidth = -1;
 	if (_deltaBuf) {
 		free(_deltaBuf);
@@ -561,7 +600,7 @@ Codec47Decoder::~Codec47Decoder() {
 }
 
 bool Codec47Decoder::decode(byte *dst, const byte *src) {
-	if ((_tableBig == nullptr) || (_tableSmall == nullptr) || (_deltaBuf == nullptr))
+	if ((_tableBig == nullptr) || (_tableSmall == nullptr) || (_maskBig == nullptr) || (_maskSmall == nullptr) || (_deltaBuf == nullptr))
 		return false;
 
 	_offset1 = _deltaBufs[1] - _curBuf;
@@ -40,6 +40,10 @@ private:
 	int32 _offset1, _offset2;
 	byte *_tableBig;
 	byte *_tableSmall;
+	// Per pattern masks of the two colour blocks, 0xFF where a pixel takes
+	// the first colour. 256 * 64 bytes for 8x8 and 256 * 16 bytes for 4x4.
+	byte *_maskBig;
+	byte *_maskSmall;
 	int16 _table[256];
 	int32 _frameSize;
 	int _width, _height;
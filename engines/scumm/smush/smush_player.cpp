@@ -229,6 +229,8 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_base = nullptr;
 	_frameBuffer = nullptr;
 	_specialBuffer = nullptr;
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
 
 	_seekPos = -1;
 
@@ -320,6 +322,10 @@ void SmushPlayer::release() {
 	free(_frameBuffer);
 	_frameBuffer = nullptr;
 
+	free(_chunkBuffer);
+	_chunkBuffer = nullptr;
+	_chunkBufferSize = 0;
+
 	_IACTstream = nullptr;
 
 	_vm->_smushActive = false;
@@ -843,14 +849,18 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 	b.readUint16LE();
 
+	// The frame object data is read into a buffer which is kept around
+	// for the next frames, to avoid an allocation per frame
 	int32 chunk_size = subSize - 14;
-	byte *chunk_buffer = (byte *)malloc(chunk_size);
-	assert(chunk_buffer);
-	b.read(chunk_buffer, chunk_size);
-
-	decodeFrameObject(codec, chunk_buffer, left, top, width, height);
+	if (chunk_size > _chunkBufferSize) {
+		free(_chunkBuffer);
+		_chunkBuffer = (byte *)malloc(chunk_size);
+		assert(_chunkBuffer);
+		_chunkBufferSize = chunk_size;
+	}
+	b.read(_chunkBuffer, chunk_size);
 
-	free(chunk_buffer);
+	decodeFrameObject(codec, _chunkBuffer, left, top, width, height);
 }
 
 void SmushPlayer::handleFrame(int32 frameSize, Common::SeekableReadStream &b) {
@@ -27,6 +27,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/substream.h"
 
 namespace Stark {
@@ -96,12 +97,27 @@ Common::String XARCMember::readString(Common::ReadStream &stream) {
 // ARCHIVE
 
 bool XARCArchive::open(const Common::String &filename) {
-	Common::File stream;
-	if (!stream.open(filename)) {
+	Common::File file;
+	if (!file.open(filename)) {
 		return false;
 	}
 
 	_filename = filename;
+	_members.clear();
+	_membersByName.clear();
+
+	// The directory ends where the data of the first member starts,
+	// read it at once rather than entry by entry from the file
+	file.seek(8);
+	uint32 directorySize = file.readUint32LE();
+	if (directorySize < 12 || directorySize > (uint32)file.size()) {
+		warning("Stark::XARC: \"%s\" has an invalid directory size %u", _filename.c_str(), directorySize);
+		return false;
+	}
+	file.seek(0);
+
+	Common::SeekableReadStream *directory = file.readStream(directorySize);
+	Common::SeekableReadStream &stream = *directory;
 
 	// Unknown: always 1? version?
 	uint32 unknown = stream.readUint32LE();
@@ -120,12 +136,21 @@ bool XARCArchive::open(const Common::String &filename) {
 
 	for (uint32 i = 0; i < numFiles; i++) {
 		XARCMember *member = new XARCMember(this, stream, offset);
-		_members.push_back(Common::ArchiveMemberPtr(member));
+		Common::ArchiveMemberPtr memberPtr(member);
+		_members.push_back(memberPtr);
+
+		// Keep the first member when a name is used several times,
+		// as a linear search would
+		if (!_membersByName.contains(member->getName())) {
+			_membersByName.setVal(member->getName(), memberPtr);
+		}
 
 		// Set the offset to the next member
 		offset += member->getLength();
 	}
 
+	delete directory;
+
 	return true;
 }
 
@@ -134,16 +159,7 @@ Common::String XARCArchive::getFilename() const {
 }
 
 bool XARCArchive::hasFile(const Common::Path &path) const {
-	Common::String name = path.toString();
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return true;
-		}
-	}
-
-	// Not found
-	return false;
+	return _membersByName.contains(path.toString());
 }
 
 int XARCArchive::listMatchingMembers(Common::ArchiveMemberList &list, const Common::Path &pattern) const {
@@ -172,29 +188,23 @@ int XARCArchive::listMembers(Common::ArchiveMemberList &list) const {
 }
 
 const Common::ArchiveMemberPtr XARCArchive::getMember(const Common::Path &path) const {
-	Common::String name = path.toString();
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return *it;
-		}
+	MemberMap::const_iterator it = _membersByName.find(path.toString());
+	if (it == _membersByName.end()) {
+		// Not found, return an empty ptr
+		return Common::ArchiveMemberPtr();
 	}
 
-	// Not found, return an empty ptr
-	return Common::ArchiveMemberPtr();
+	return it->_value;
 }
 
 Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const Common::Path &path) const {
-	Common::String name = path.toString();
-	for (Common::ArchiveMemberList::const_iterator it = _members.begin(); it != _members.end(); ++it) {
-		if ((*it)->getName() == name) {
-			// Found it
-			return createReadStreamForMember((const XARCMember *)it->get());
-		}
+	MemberMap::const_iterator it = _membersByName.find(path.toString());
+	if (it == _membersByName.end()) {
+		// Not found
+		return 0;
 	}
 
-	// Not found
-	return 0;
+	return createReadStreamForMember((const XARCMember *)it->_value.get());
 }
 
 Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMember *member) const {
@@ -208,14 +218,29 @@ Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMem
 		return NULL;
 	}
 
-	// Return the substream that contains the archive member
 	uint32 offset = member->getOffset();
 	uint32 length = member->getLength();
-	return new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
 
-	// Different approach: keep the archive open and read full resources to memory
-	//f.seek(member->getOffset());
-	//return f.readStream(member->getLength());
+	if (length == 0) {
+		delete f;
+		return new Common::MemoryReadStream(nullptr, 0);
+	}
+
+	// Small members are read to memory at once
+	if (length <= kMaxInMemoryMemberSize) {
+		f->seek(offset);
+		byte *data = (byte *)malloc(length);
+		if (data && f->read(data, length) == length) {
+			delete f;
+			return new Common::MemoryReadStream(data, length, DisposeAfterUse::YES);
+		}
+
+		// The member is truncated, let the substream report it when read
+		free(data);
+	}
+
+	// Return the substream that contains the archive member
+	return new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
 }
 
 } // End of namespace Formats
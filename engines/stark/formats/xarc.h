@@ -23,6 +23,8 @@
 #define STARK_ARCHIVE_H
 
 #include "common/archive.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 #include "common/stream.h"
 
 namespace Stark {
@@ -45,8 +47,18 @@ public:
 	Common::SeekableReadStream *createReadStreamForMember(const XARCMember *member) const;
 
 private:
+	/**
+	 * Members up to this size are read to memory in a single read when
+	 * opened. The resource parsers make many small reads, which are much
+	 * cheaper from memory than through a stream over the archive file.
+	 */
+	static const uint32 kMaxInMemoryMemberSize = 512 * 1024;
+
+	typedef Common::HashMap<Common::String, Common::ArchiveMemberPtr> MemberMap;
+
 	Common::String _filename;
 	Common::ArchiveMemberList _members;
+	MemberMap _membersByName;
 };
 
 } // End of namespace Formats
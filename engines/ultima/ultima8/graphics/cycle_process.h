@@ -43,6 +43,10 @@ public:
 
 	void run() override;
 
+	bool isDeferrable() const override {
+		return true;
+	}
+
 	static CycleProcess *get_instance();
 
 	void pauseCycle() {
@@ -22,6 +22,8 @@
 #ifndef ULTIMA8_GRAPHICS_SHAPEFRAME_H
 #define ULTIMA8_GRAPHICS_SHAPEFRAME_H
 
+#include "common/array.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -40,9 +42,24 @@ public:
 	uint8 *_pixels;
 	uint8 *_mask;
 
+	//! A run of opaque pixels on a line of the frame
+	struct Span {
+		int32 _start;
+		int32 _length;
+	};
+
+	//! The opaque runs of all lines, so painting can skip the transparent
+	//! pixels without looking at the mask. The runs of line y are the
+	//! entries from _lineSpans[y] up to (not including) _lineSpans[y + 1].
+	Common::Array<Span> _spans;
+	Common::Array<uint32> _lineSpans;
+
 	bool hasPoint(int32 x, int32 y) const;  // Check to see if a point is in the frame
 
 	uint8 getPixelAtPoint(int32 x, int32 y) const;  // Get the pixel at the point
+
+private:
+	void buildSpans();
 };
 
 } // End of namespace Ultima8
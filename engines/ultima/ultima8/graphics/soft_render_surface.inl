@@ -49,9 +49,8 @@
 //
 // NOT_CLIPPED_Y - Does Y Clipping check per line
 //
-// NOT_CLIPPED_X - Does X Clipping check per Pixel
-//
-// LINE_END_ASSIGN - Calcuates the line_end pointer required for X clipping
+// SRC_CLIP_LEFT, SRC_CLIP_RIGHT - Range of source columns inside the clip
+// window, used to clip each span of opaque pixels
 //
 // XNEG - Negates X values if doing shape flipping
 //
@@ -102,9 +101,9 @@ const int32 neg = (FLIP_CONDITIONAL)?-1:0;
 //
 #ifdef NO_CLIPPING
 
-#define LINE_END_ASSIGN //
-#define NOT_CLIPPED_X (1)
 #define NOT_CLIPPED_Y (1)
+#define SRC_CLIP_LEFT (0)
+#define SRC_CLIP_RIGHT (width_)
 #define OFFSET_PIXELS (_pixels)
 
 //
@@ -115,9 +114,9 @@ const int32 neg = (FLIP_CONDITIONAL)?-1:0;
 	const int		scrn_width = _clipWindow.width();
 	const int		scrn_height = _clipWindow.height();
 
-#define LINE_END_ASSIGN const uintX *dst_line_end = dst_line_start + scrn_width
-#define NOT_CLIPPED_X (dstpix >= dst_line_start && dstpix < dst_line_end)
 #define NOT_CLIPPED_Y (line >= 0 && line < scrn_height)
+#define SRC_CLIP_LEFT (src_clip_left)
+#define SRC_CLIP_RIGHT (src_clip_right)
 #define OFFSET_PIXELS (off_pixels)
 
 	uint8			*off_pixels  = _pixels + _clipWindow.left * sizeof(uintX) + _clipWindow.top * _pitch;
@@ -174,7 +173,8 @@ const int32 neg = (FLIP_CONDITIONAL)?-1:0;
 	if (!frame)
 		return;
 	const uint8		*srcpixels		= frame->_pixels;
-	const uint8		*srcmask		= frame->_mask;
+	const ShapeFrame::Span *spans	= frame->_spans.data();
+	const uint32	*linespans		= frame->_lineSpans.data();
 	const uint32	*pal			= untformed_pal ?
 										s->getPalette()->_native_untransformed:
 										s->getPalette()->_native;
@@ -190,33 +190,48 @@ const int32 neg = (FLIP_CONDITIONAL)?-1:0;
 	x -= XNEG(frame->_xoff);
 	y -= frame->_yoff;
 
-	assert(_pixels00 && _pixels && srcpixels && srcmask);
+	assert(_pixels00 && _pixels && srcpixels && linespans);
+
+#ifndef NO_CLIPPING
+	// Source column xpos lands on screen column x + XNEG(xpos)
+	int32 src_clip_left, src_clip_right;
+	if (XNEG(1) < 0) {
+		src_clip_left = x - scrn_width + 1;
+		src_clip_right = x + 1;
+	} else {
+		src_clip_left = -x;
+		src_clip_right = scrn_width - x;
+	}
+#endif
 
 	for (int i = 0; i < height_; i++)  {
 		const int line = y + i;
 
 		if (NOT_CLIPPED_Y) {
 			const uint8	*srcline = srcpixels + i * width_;
-			const uint8	*srcmaskline = srcmask + i * width_;
 			uintX *dst_line_start = reinterpret_cast<uintX *>(OFFSET_PIXELS + _pitch * line);
-			LINE_END_ASSIGN;
 
-			for (int xpos = 0; xpos < width_; xpos++) {
-				if (srcmaskline[xpos] == 0)
-					continue;
-
-				uintX *dstpix = dst_line_start + x + XNEG(xpos);
-
-				if (NOT_CLIPPED_X && NOT_DESTINATION_MASKED) {
-					const uint8 *srcpix = srcline + xpos;
-					#ifdef XFORM_SHAPES
-					if (USE_XFORM_FUNC) {
-						*dstpix = CUSTOM_BLEND(BlendPreModulated(xform_pal[*srcpix], *dstpix));
-					}
-					else
-					#endif
-					{
-						*dstpix = CUSTOM_BLEND(pal[*srcpix]);
+			for (uint32 spanidx = linespans[i]; spanidx < linespans[i + 1]; spanidx++) {
+				const int32 xstart = MAX<int32>(spans[spanidx]._start, SRC_CLIP_LEFT);
+				const int32 xend = MIN<int32>(spans[spanidx]._start + spans[spanidx]._length, SRC_CLIP_RIGHT);
+
+				for (int32 xpos = xstart; xpos < xend; xpos++) {
+					uintX *dstpix = dst_line_start + x + XNEG(xpos);
+
+					if (NOT_DESTINATION_MASKED) {
+						const uint8 *srcpix = srcline + xpos;
+						#ifdef XFORM_SHAPES
+						// Only a handful of palette indices have an xform
+						// colour, so these pixels are rare and scattered
+						// among the opaque ones, and are blended one by one
+						if (USE_XFORM_FUNC) {
+							*dstpix = CUSTOM_BLEND(BlendPreModulated(xform_pal[*srcpix], *dstpix));
+						}
+						else
+						#endif
+						{
+							*dstpix = CUSTOM_BLEND(pal[*srcpix]);
+						}
 					}
 				}
 			}
@@ -226,8 +241,8 @@ const int32 neg = (FLIP_CONDITIONAL)?-1:0;
 #undef NOT_DESTINATION_MASKED
 #undef OFFSET_PIXELS
 #undef CUSTOM_BLEND
-#undef LINE_END_ASSIGN
-#undef NOT_CLIPPED_X
+#undef SRC_CLIP_LEFT
+#undef SRC_CLIP_RIGHT
 #undef NOT_CLIPPED_Y
 #undef XNEG
 #undef USE_XFORM_FUNC
@@ -24,6 +24,8 @@
 #include "ultima/ultima8/kernel/process.h"
 #include "ultima/ultima8/misc/id_man.h"
 #include "ultima/ultima8/ultima8.h"
+#include "common/algorithm.h"
+#include "common/system.h"
 
 namespace Ultima {
 namespace Ultima8 {
@@ -42,7 +44,8 @@ const uint16 Kernel::PROC_TYPE_ALL = 6;
 static const uint16 CRU_PROC_TYPE_ALL = 0xc;
 
 Kernel::Kernel() : _loading(false), _tickNum(0), _paused(0),
-		_runningProcess(nullptr), _frameByFrame(false) {
+		_runningProcess(nullptr), _frameByFrame(false), _profiling(false),
+		_tickBudget(0), _deferredLastTick(0) {
 	debugN(MM_INFO, "Creating Kernel...\n");
 
 	_kernel = this;
@@ -145,6 +148,10 @@ void Kernel::runProcesses() {
 
 	int num_run = 0;
 
+	// Only look at the clock when someone is interested in the time
+	const uint32 tickStart = (_profiling || _tickBudget) ? g_system->getMillis() : 0;
+	_deferredLastTick = 0;
+
 	_currentProcess = _processes.begin();
 	while (_currentProcess != _processes.end()) {
 		Process *p = *_currentProcess;
@@ -156,10 +163,38 @@ void Kernel::runProcesses() {
 		}
 		if (!(p->is_terminated() || p->is_suspended()) &&
 		        (!_paused || (p->_flags & Process::PROC_RUNPAUSED)) &&
-				(_paused || _tickNum % p->getTicksPerRun() == 0)) {
+				(_paused || _tickNum % p->getTicksPerRun() == 0 ||
+				 (p->_flags & Process::PROC_RUN_DEFERRED))) {
+			// Keep the tick within its budget by pushing cosmetic processes
+			// to the next tick. A process is never deferred twice in a row.
+			if (!_paused && _tickBudget && p->isDeferrable() &&
+			        !(p->_flags & Process::PROC_RUN_DEFERRED) &&
+			        g_system->getMillis() - tickStart > _tickBudget) {
+				p->_flags |= Process::PROC_RUN_DEFERRED;
+				_deferredLastTick++;
+				if (_profiling)
+					_profile[p->GetClassType()._className]._deferred++;
+				++_currentProcess;
+				continue;
+			}
+			p->_flags &= ~Process::PROC_RUN_DEFERRED;
+
+			// The process may be gone after running, so get its name now
+			const char *className = p->GetClassType()._className;
+			const uint32 runStart = _profiling ? g_system->getMillis() : 0;
+
 			_runningProcess = p;
 			p->run();
 
+			if (_profiling) {
+				const uint32 elapsed = g_system->getMillis() - runStart;
+				ProcessProfile &profile = _profile[className];
+				profile._runs++;
+				profile._time += elapsed;
+				if (elapsed > profile._maxTime)
+					profile._maxTime = elapsed;
+			}
+
 			num_run++;
 
 			//
@@ -254,6 +289,50 @@ Process *Kernel::getProcess(ProcId pid) {
 void Kernel::kernelStats() {
 	g_debugger->debugPrintf("Kernel memory stats:\n");
 	g_debugger->debugPrintf("Processes  : %u/32765\n", _processes.size());
+	if (_tickBudget)
+		g_debugger->debugPrintf("Tick budget: %u ms (%u deferred last tick)\n",
+		                        _tickBudget, _deferredLastTick);
+}
+
+void Kernel::setProfiling(bool profiling) {
+	if (profiling && !_profiling)
+		_profile.clear();
+	_profiling = profiling;
+}
+
+namespace {
+
+typedef Std::map<Common::String, Kernel::ProcessProfile>::const_iterator ProfileIter;
+
+struct ProfileTimeGreater {
+	bool operator()(const ProfileIter &a, const ProfileIter &b) const {
+		if (a->_value._time != b->_value._time)
+			return a->_value._time > b->_value._time;
+		return a->_value._runs > b->_value._runs;
+	}
+};
+
+} // End of anonymous namespace
+
+void Kernel::profileStats() {
+	if (_profile.empty()) {
+		g_debugger->debugPrintf("No process timings collected%s.\n",
+		                        _profiling ? " yet" : ", profiling is off");
+		return;
+	}
+
+	Common::Array<ProfileIter> sorted;
+	for (ProfileIter iter = _profile.begin(); iter != _profile.end(); ++iter)
+		sorted.push_back(iter);
+	Common::sort(sorted.begin(), sorted.end(), ProfileTimeGreater());
+
+	g_debugger->debugPrintf("Process times (runs, total ms, max ms, deferred):\n");
+	for (uint i = 0; i < sorted.size(); i++) {
+		const ProcessProfile &profile = sorted[i]->_value;
+		g_debugger->debugPrintf("%s: %u, %u, %u, %u\n", sorted[i]->_key.c_str(),
+		                        profile._runs, profile._time, profile._maxTime,
+		                        profile._deferred);
+	}
 }
 
 void Kernel::processTypes() {
@@ -94,6 +94,35 @@ public:
 	void kernelStats();
 	void processTypes();
 
+	//! Time spent in each process type, collected while profiling is on
+	struct ProcessProfile {
+		ProcessProfile() : _runs(0), _deferred(0), _time(0), _maxTime(0) {}
+
+		uint32 _runs;
+		uint32 _deferred;	//!< runs pushed to the next tick by the budget
+		uint32 _time;		//!< total time spent in run(), in ms
+		uint32 _maxTime;	//!< longest single run(), in ms
+	};
+
+	//! start or stop collecting per process type timings.
+	//! Starting discards the previously collected data.
+	void setProfiling(bool profiling);
+	bool isProfiling() const {
+		return _profiling;
+	}
+
+	//! print the collected timings, most expensive process types first
+	void profileStats();
+
+	//! Set the time in ms a tick may take before deferrable processes are
+	//! pushed to the next tick. 0 disables the budget.
+	void setTickBudget(uint32 ms) {
+		_tickBudget = ms;
+	}
+	uint32 getTickBudget() const {
+		return _tickBudget;
+	}
+
 	void save(Common::WriteStream *ws);
 	bool load(Common::ReadStream *rs, uint32 version);
 
@@ -153,6 +182,12 @@ private:
 
 	Process *_runningProcess;
 
+	bool _profiling;
+	Std::map<Common::String, ProcessProfile> _profile;
+
+	uint32 _tickBudget;
+	uint32 _deferredLastTick;
+
 	static Kernel *_kernel;
 };
 
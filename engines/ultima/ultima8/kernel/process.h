@@ -110,6 +110,12 @@ public:
 		return _ticksPerRun;
 	}
 
+	//! Can the kernel push this process to the next tick when the current
+	//! tick runs over its time budget? Only for purely cosmetic processes.
+	virtual bool isDeferrable() const {
+		return false;
+	}
+
 	//! dump some info about this process to pout
 	virtual void dumpInfo() const;
 
@@ -153,7 +159,8 @@ public:
 		PROC_TERMINATED  = 0x0004,
 		PROC_TERM_DEFERRED = 0x0008, //!< automatically call terminate next frame
 		PROC_FAILED      = 0x0010,
-		PROC_RUNPAUSED   = 0x0020    //!< run even if game is paused
+		PROC_RUNPAUSED   = 0x0020,   //!< run even if game is paused
+		PROC_RUN_DEFERRED = 0x0040   //!< skipped due to the tick budget, run next tick
 	};
 
 };
@@ -149,6 +149,9 @@ Debugger::Debugger() : Shared::Debugger() {
 	registerCmd("Kernel::listProcesses", WRAP_METHOD(Debugger, cmdListProcesses));
 	registerCmd("Kernel::toggleFrameByFrame", WRAP_METHOD(Debugger, cmdToggleFrameByFrame));
 	registerCmd("Kernel::advanceFrame", WRAP_METHOD(Debugger, cmdAdvanceFrame));
+	registerCmd("Kernel::toggleProfiling", WRAP_METHOD(Debugger, cmdToggleProfiling));
+	registerCmd("Kernel::profile", WRAP_METHOD(Debugger, cmdProcessProfile));
+	registerCmd("Kernel::setTickBudget", WRAP_METHOD(Debugger, cmdSetTickBudget));
 
 	registerCmd("MainActor::teleport", WRAP_METHOD(Debugger, cmdTeleport));
 	registerCmd("MainActor::mark", WRAP_METHOD(Debugger, cmdMark));
@@ -192,6 +195,7 @@ Debugger::Debugger() : Shared::Debugger() {
 
 	registerCmd("UCMachine::getGlobal", WRAP_METHOD(Debugger, cmdGetGlobal));
 	registerCmd("UCMachine::setGlobal", WRAP_METHOD(Debugger, cmdSetGlobal));
+	registerCmd("UCMachine::profile", WRAP_METHOD(Debugger, cmdUsecodeProfile));
 #ifdef DEBUG
 	registerCmd("UCMachine::traceObjID", WRAP_METHOD(Debugger, cmdTraceObjID));
 	registerCmd("UCMachine::tracePID", WRAP_METHOD(Debugger, cmdTracePID));
@@ -921,6 +925,37 @@ bool Debugger::cmdAdvanceFrame(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdToggleProfiling(int argc, const char **argv) {
+	Kernel *kern = Kernel::get_instance();
+	bool profiling = !kern->isProfiling();
+	kern->setProfiling(profiling);
+	UCMachine::get_instance()->setProfiling(profiling);
+	debugPrintf("Profiling = %s\n", strBool(profiling));
+	return true;
+}
+
+bool Debugger::cmdProcessProfile(int argc, const char **argv) {
+	Kernel::get_instance()->profileStats();
+	return true;
+}
+
+bool Debugger::cmdSetTickBudget(int argc, const char **argv) {
+	Kernel *kern = Kernel::get_instance();
+	if (argc > 2) {
+		debugPrintf("usage: Kernel::setTickBudget [<ms>]\n");
+		return true;
+	}
+
+	if (argc == 2)
+		kern->setTickBudget(strtol(argv[1], 0, 0));
+
+	if (kern->getTickBudget())
+		debugPrintf("Tick budget = %u ms\n", kern->getTickBudget());
+	else
+		debugPrintf("Tick budget disabled\n");
+	return true;
+}
+
 
 bool Debugger::cmdTeleport(int argc, const char **argv) {
 	if (!Ultima8Engine::get_instance()->areCheatsEnabled()) {
@@ -1611,6 +1646,17 @@ bool Debugger::cmdSetGlobal(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdUsecodeProfile(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("usage: UCMachine::profile [<count>]\n");
+		return true;
+	}
+
+	uint count = argc == 2 ? strtol(argv[1], 0, 0) : 20;
+	UCMachine::get_instance()->profileStats(count);
+	return true;
+}
+
 #ifdef DEBUG
 
 bool Debugger::cmdTracePID(int argc, const char **argv) {
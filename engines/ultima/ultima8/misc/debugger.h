@@ -213,6 +213,9 @@ private:
 	bool cmdProcessInfo(int argc, const char **argv);
 	bool cmdToggleFrameByFrame(int argc, const char **argv);
 	bool cmdAdvanceFrame(int argc, const char **argv);
+	bool cmdToggleProfiling(int argc, const char **argv);
+	bool cmdProcessProfile(int argc, const char **argv);
+	bool cmdSetTickBudget(int argc, const char **argv);
 
 	// Main Actor
 	bool cmdTeleport(int argc, const char **argv);
@@ -260,6 +263,7 @@ private:
 	// UCMachine
 	bool cmdGetGlobal(int argc, const char **argv);
 	bool cmdSetGlobal(int argc, const char **argv);
+	bool cmdUsecodeProfile(int argc, const char **argv);
 #ifdef DEBUG
 	bool cmdTracePID(int argc, const char **argv);
 	bool cmdTraceObjID(int argc, const char **argv);
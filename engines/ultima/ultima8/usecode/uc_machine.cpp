@@ -19,7 +19,9 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/memstream.h"
+#include "common/system.h"
 
 #include "ultima/ultima8/misc/pent_include.h"
 #include "ultima/ultima8/usecode/uc_machine.h"
@@ -80,7 +82,7 @@ enum UCSegments {
 
 UCMachine *UCMachine::_ucMachine = nullptr;
 
-UCMachine::UCMachine(Intrinsic *iset, unsigned int icount) {
+UCMachine::UCMachine(Intrinsic *iset, unsigned int icount) : _profiling(false) {
 	debugN(MM_INFO, "Creating UCMachine...\n");
 
 	_ucMachine = this;
@@ -173,10 +175,26 @@ void UCMachine::execProcess(UCProcess *p) {
 	bool error = false;
 	bool go_until_cede = false;
 
+	// Calls and returns switch classes, so the time of a run is charged to
+	// the class it started in while instructions are counted where they run
+	const uint16 startClassId = p->_classId;
+	const uint32 startTime = _profiling ? g_system->getMillis() : 0;
+	uint16 countClassId = startClassId;
+	uint32 instructions = 0;
+
 	while (!cede && !error && !p->is_terminated()) {
 		//! guard against reading past end of class
 		//! guard against other error conditions
 
+		if (_profiling) {
+			if (p->_classId != countClassId) {
+				profileInstructions(p, countClassId, instructions);
+				countClassId = p->_classId;
+				instructions = 0;
+			}
+			instructions++;
+		}
+
 		uint8 opcode = cs->readByte();
 
 #ifdef DEBUG
@@ -2032,6 +2050,17 @@ void UCMachine::execProcess(UCProcess *p) {
 
 	delete cs;
 
+	if (_profiling) {
+		profileInstructions(p, countClassId, instructions);
+
+		const uint32 elapsed = g_system->getMillis() - startTime;
+		ClassProfile &profile = _classProfile[startClassId];
+		profile._runs++;
+		profile._time += elapsed;
+		if (elapsed > profile._maxTime)
+			profile._maxTime = elapsed;
+	}
+
 	if (error) {
 		perr.Print("Process %d caused an error at %04X:%04X (item %d). Killing process.\n",
 		            p->_pid, p->_classId, p->_ip, p->_itemNum);
@@ -2328,6 +2357,58 @@ void UCMachine::usecodeStats() const {
 #endif
 }
 
+void UCMachine::profileInstructions(const UCProcess *p, uint16 classId, uint32 count) {
+	if (!count)
+		return;
+
+	ClassProfile &profile = _classProfile[classId];
+	if (!profile._name)
+		profile._name = p->_usecode->get_class_name(classId);
+	profile._instructions += count;
+}
+
+void UCMachine::setProfiling(bool profiling) {
+	if (profiling && !_profiling)
+		_classProfile.clear();
+	_profiling = profiling;
+}
+
+namespace {
+
+template<class Iter>
+struct ClassProfileGreater {
+	bool operator()(const Iter &a, const Iter &b) const {
+		if (a->_value._time != b->_value._time)
+			return a->_value._time > b->_value._time;
+		return a->_value._instructions > b->_value._instructions;
+	}
+};
+
+} // End of anonymous namespace
+
+void UCMachine::profileStats(uint count) const {
+	if (_classProfile.empty()) {
+		g_debugger->debugPrintf("No usecode timings collected%s.\n",
+		                        _profiling ? " yet" : ", profiling is off");
+		return;
+	}
+
+	typedef Std::map<uint16, ClassProfile>::const_iterator ProfileIter;
+	Common::Array<ProfileIter> sorted;
+	for (ProfileIter iter = _classProfile.begin(); iter != _classProfile.end(); ++iter)
+		sorted.push_back(iter);
+	Common::sort(sorted.begin(), sorted.end(), ClassProfileGreater<ProfileIter>());
+
+	g_debugger->debugPrintf("Usecode classes (runs, instructions, total ms, max ms):\n");
+	for (uint i = 0; i < sorted.size() && i < count; i++) {
+		const ClassProfile &profile = sorted[i]->_value;
+		g_debugger->debugPrintf("%04X %s: %u, %u, %u, %u\n", sorted[i]->_key,
+		                        profile._name ? profile._name : "<unnamed>",
+		                        profile._runs, profile._instructions,
+		                        profile._time, profile._maxTime);
+	}
+}
+
 void UCMachine::saveGlobals(Common::WriteStream *ws) const {
 	_globals->save(ws);
 }
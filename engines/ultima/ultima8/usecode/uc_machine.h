@@ -62,6 +62,17 @@ public:
 
 	void usecodeStats() const;
 
+	//! start or stop counting the instructions and time spent per usecode
+	//! class. Starting discards the previously collected data.
+	void setProfiling(bool profiling);
+	bool isProfiling() const {
+		return _profiling;
+	}
+
+	//! print the usecode classes that took the most time
+	//! \param count the number of classes to print
+	void profileStats(uint count) const;
+
 	static uint32 listToPtr(uint16 l);
 	static uint32 stringToPtr(uint16 s);
 	static uint32 stackToPtr(uint16 pid, uint16 offset);
@@ -111,6 +122,22 @@ private:
 
 	static UCMachine *_ucMachine;
 
+	struct ClassProfile {
+		ClassProfile() : _name(nullptr), _runs(0), _instructions(0), _time(0), _maxTime(0) {}
+
+		const char *_name;
+		uint32 _runs;			//!< times a process was started in this class
+		uint32 _instructions;	//!< instructions executed in this class
+		uint32 _time;			//!< total ms of the runs started in this class
+		uint32 _maxTime;		//!< longest single run, in ms
+	};
+
+	bool _profiling;
+	Std::map<uint16, ClassProfile> _classProfile;
+
+	//! Charge a number of executed instructions to a class of the process
+	void profileInstructions(const UCProcess *p, uint16 classId, uint32 count);
+
 #ifdef DEBUG
 	// tracing
 	bool _tracingEnabled;
@@ -597,6 +597,12 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 				int32 ix, iy, iz;
 				item->getLocation(ix, iy, iz);
 
+				// The item's far corner is its origin, so an item whose
+				// origin lies before the search range can be rejected
+				// without looking up its shape.
+				if (ix <= searchrange.left || iy <= searchrange.top)
+					continue;
+
 				int32 ixd, iyd, izd;
 				item->getFootpadWorld(ixd, iyd, izd);
 
@@ -663,6 +669,9 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 				// check if item is in range?
 				int32 ix, iy, iz;
 				item->getLocation(ix, iy, iz);
+				if (ix <= searchrange.left || iy <= searchrange.top)
+					continue;
+
 				int32 ixd, iyd, izd;
 				item->getFootpadWorld(ixd, iyd, izd);
 
@@ -785,14 +794,22 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				int32 ix, iy, iz, ixd, iyd, izd;
+				item->getLocation(ix, iy, iz);
+
+				// Every test below needs the item to reach past the low x
+				// and y edges of the box, which only depends on the item's
+				// origin. Most items in the surrounding chunks fail this,
+				// so check it before fetching the shape info and footpad.
+				if (x - xd >= ix || y - yd >= iy)
+					continue;
+
 				const ShapeInfo *si = item->getShapeInfo();
 				//!! need to check is_sea() and is_land() maybe?
 				if (!(si->_flags & flagmask))
 					continue; // not an interesting item
 
-				int32 ix, iy, iz, ixd, iyd, izd;
 				item->getFootpadWorld(ixd, iyd, izd);
-				item->getLocation(ix, iy, iz);
 
 #if 0
 				if (item->getShape() == 145) {
@@ -1073,6 +1090,11 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 //	pout << "Sweeping to   (" << vel[0]-ext[0] << ", " << vel[1]-ext[1] << ", " << vel[2]-ext[2] << ")" << Std::endl;
 //	pout << "              (" << vel[0]+ext[0] << ", " << vel[1]+ext[1] << ", " << vel[2]+ext[2] << ")" << Std::endl;
 
+	// Low x and y corner of the swept box. Items whose origin lies more
+	// than a unit before it can't even touch the box along the way.
+	const int32 sweepminx = MIN(start[0], end[0]) - dims[0] - 1;
+	const int32 sweepminy = MIN(start[1], end[1]) - dims[1] - 1;
+
 	Std::list<SweepItem>::iterator sw_it;
 	if (hit) sw_it = hit->end();
 
@@ -1087,6 +1109,11 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 				if (other_item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
+				int32 other[3], oext[3];
+				other_item->getLocation(other[0], other[1], other[2]);
+				if (other[0] < sweepminx || other[1] < sweepminy)
+					continue;
+
 				uint32 othershapeflags = other_item->getShapeInfo()->_flags;
 				bool blocking = (othershapeflags & shapeflags &
 				                 blockflagmask) != 0;
@@ -1096,8 +1123,6 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 				if (blocking_only && !blocking)
 					continue;
 
-				int32 other[3], oext[3];
-				other_item->getLocation(other[0], other[1], other[2]);
 				other_item->getFootpadWorld(oext[0], oext[1], oext[2]);
 
 				// If the objects overlapped at the start, ignore collision.
@@ -43,7 +43,8 @@ namespace Ultima8 {
 
 ItemSorter::ItemSorter() :
 	_shapes(nullptr), _surf(nullptr), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0) {
+	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0),
+	_columns(new SortItemColumns()), _sequence(0) {
 	int i = 2048;
 	while (i--) _itemsUnused = new SortItem(_itemsUnused);
 }
@@ -64,6 +65,7 @@ ItemSorter::~ItemSorter() {
 	}
 
 	delete [] _items;
+	delete _columns;
 }
 
 void ItemSorter::BeginDisplayList(RenderSurface *rs,
@@ -82,6 +84,12 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	// Set the RenderSurface, and reset the item list
 	_surf = rs;
 	_orderCounter = 0;
+	_sequence = 0;
+
+	// Reset the columns, keeping their storage for the next frame
+	Rect clipWindow;
+	_surf->GetClippingRect(clipWindow);
+	_columns->reset(clipWindow.left, clipWindow.width());
 
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	_camSx = (camx - camy) / 4;
@@ -89,6 +97,16 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	_camSy = (camx + camy) / 8 - camz;
 }
 
+namespace {
+
+struct ListOrderLess {
+	bool operator()(const SortItem *a, const SortItem *b) const {
+		return a->ListOrderLessThan(b);
+	}
+};
+
+} // End of anonymous namespace
+
 void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) {
 
 	// First thing, get a SortItem to use (first of unused)
@@ -179,20 +197,24 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 
 	si->_occluded = false;
 	si->_order = -1;
+	si->_sequence = ++_sequence;
+	si->_candidateMark = 0;
 
 	// We will clear all the vector memory
 	// Stictly speaking the vector will sort of leak memory, since they
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Gather the items sharing a screen column with us. Those are the only
+	// ones which may overlap us.
+	Std::vector<SortItem *> &candidates = _columns->gatherCandidates(si);
 
-	// Ok,
-	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->ListLessThan(si2))
-			addpoint = si2;
+	// Compare them in display list order, as the dependency lists and the
+	// occlusion checks depend on it
+	Common::sort(candidates.begin(), candidates.end(), ListOrderLess());
+
+	for (uint i = 0; i < candidates.size(); i++) {
+		SortItem *si2 = candidates[i];
 
 		// Doesn't overlap
 		if (si2->_occluded || !si->overlap(*si2))
@@ -219,6 +241,15 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 		}
 	}
 
+	// Get the insert point... which is after the last item that does not
+	// have a higher z than us. Items are usually added roughly in z order,
+	// so search from the end.
+	SortItem *addpoint = nullptr;
+	for (SortItem *si2 = _itemsTail; si2 != nullptr && si->ListLessThan(si2); si2 = si2->_prev)
+		addpoint = si2;
+
+	_columns->add(si);
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
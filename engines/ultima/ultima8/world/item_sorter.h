@@ -22,6 +22,8 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "ultima/shared/std/containers.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -29,6 +31,7 @@ class MainShapeArchive;
 class Item;
 class RenderSurface;
 struct SortItem;
+struct SortItemColumns;
 
 class ItemSorter {
 	MainShapeArchive    *_shapes;
@@ -43,6 +46,9 @@ class ItemSorter {
 
 	int32       _camSx, _camSy;
 
+	SortItemColumns *_columns;
+	uint32      _sequence;
+
 public:
 	ItemSorter();
 	~ItemSorter();
@@ -46,7 +46,7 @@ struct SortItem {
 			_occl(false), _solid(false), _draw(false), _roof(false),
 			_noisy(false), _anim(false), _trans(false), _fixed(false),
 			_land(false), _occluded(false), _clipped(false), _sprite(false),
-			_invitem(false) { }
+			_invitem(false), _sequence(0), _candidateMark(0) { }
 
 	SortItem                *_next;
 	SortItem                *_prev;
@@ -112,6 +112,9 @@ struct SortItem {
 
 	int32   _order;      // Rendering _order. -1 is not yet drawn
 
+	uint32  _sequence;      // Order in which the item was added to the display list
+	uint32  _candidateMark; // Last item for which this one was an overlap candidate
+
 	// Note that Std::priority_queue could be used here, BUT there is no guarentee that it's implementation
 	// will be friendly to insertions
 	// Alternatively i could use Std::list, BUT there is no guarentee that it will keep wont delete
@@ -232,6 +235,16 @@ struct SortItem {
 		return _z < other->_z || (_z == other->_z && _flat && !other->_flat);
 	}
 
+	// The position in the display list. Items which compare equal with
+	// ListLessThan are kept in the order they were added.
+	inline bool ListOrderLessThan(const SortItem *other) const {
+		if (ListLessThan(other))
+			return true;
+		if (other->ListLessThan(this))
+			return false;
+		return _sequence < other->_sequence;
+	}
+
 };
 
 inline bool SortItem::overlap(const SortItem &si2) const {
@@ -401,6 +414,67 @@ inline bool SortItem::below(const SortItem &si2) const {
 	return si1._frame < si2._frame;
 }
 
+/**
+ * Buckets the sort items by the screen columns their bounding box covers,
+ * so a new item is only compared against the items which share a column
+ * with it rather than against the whole display list.
+ */
+struct SortItemColumns {
+	static const int kColumnShift = 5;
+
+	Std::vector<Std::vector<SortItem *> > _columns;
+	Std::vector<SortItem *> _candidates;
+	int32 _left;
+
+	SortItemColumns() : _left(0) { }
+
+	// Remove all the items, keeping the column storage, and set up the
+	// columns for the screen extent starting at left
+	void reset(int32 left, int32 width) {
+		_left = left;
+		uint numColumns = MAX<int32>(1, (width + (1 << kColumnShift) - 1) >> kColumnShift);
+		_columns.resize(numColumns);
+		for (uint i = 0; i < numColumns; i++)
+			_columns[i].resize(0);
+	}
+
+	// Items overlap only if their bounding box extents do. Extents
+	// outside the screen are clamped to the outer columns.
+	void getRange(const SortItem *si, uint &first, uint &last) const {
+		const int32 maxColumn = _columns.size() - 1;
+		first = CLIP<int32>((si->_sxLeft - _left) >> kColumnShift, 0, maxColumn);
+		last = CLIP<int32>((si->_sxRight - _left) >> kColumnShift, 0, maxColumn);
+	}
+
+	// Gather the items sharing a column with si, each of them once. The
+	// _sequence of si must be unique and non-zero.
+	Std::vector<SortItem *> &gatherCandidates(const SortItem *si) {
+		uint first, last;
+		getRange(si, first, last);
+
+		_candidates.resize(0);
+		for (uint col = first; col <= last; col++) {
+			const Std::vector<SortItem *> &column = _columns[col];
+			for (uint i = 0; i < column.size(); i++) {
+				SortItem *si2 = column[i];
+				if (si2->_candidateMark == si->_sequence)
+					continue;
+
+				si2->_candidateMark = si->_sequence;
+				_candidates.push_back(si2);
+			}
+		}
+		return _candidates;
+	}
+
+	void add(SortItem *si) {
+		uint first, last;
+		getRange(si, first, last);
+		for (uint col = first; col <= last; col++)
+			_columns[col].push_back(si);
+	}
+};
+
 ConsoleStream &operator<<(ConsoleStream &cs, const SortItem &si) {
 	cs << si._shapeNum << ":" << si._frame <<
 		" (" << si._xLeft << "," << si._yFar << "," << si._z << ")" <<
@@ -68,6 +68,10 @@ public:
 	//! The SpriteProcess run function
 	void run() override;
 
+	bool isDeferrable() const override {
+		return true;
+	}
+
 	INTRINSIC(I_createSprite);
 
 protected:
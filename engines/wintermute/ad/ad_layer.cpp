@@ -295,6 +295,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 			stack->pushNative(entity, true);
 		}
 		_nodes.add(node);
+		BaseRegion::bumpGeneration();
 		return STATUS_OK;
 	}
 
@@ -330,6 +331,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		} else {
 			_nodes.add(node);
 		}
+		BaseRegion::bumpGeneration();
 
 		return STATUS_OK;
 	}
@@ -329,6 +329,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Blocked") == 0) {
 		_blocked = value->getBool();
+		bumpGeneration();
 		return STATUS_OK;
 	}
 
@@ -337,6 +338,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Decoration") == 0) {
 		_decoration = value->getBool();
+		bumpGeneration();
 		return STATUS_OK;
 	}
 
@@ -94,6 +94,7 @@ void AdScene::setDefaults() {
 	_pfTargetPath = nullptr;
 	_pfRequester = nullptr;
 	_mainLayer = nullptr;
+	invalidateWalkGrid();
 #ifdef ENABLE_WME3D
 	_sceneGeometry = nullptr;
 	_showGeometry = false;
@@ -361,43 +362,60 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = true;
+	if (checkFreeObjects && isBlockedByFreeObjectAt(x, y, requester)) {
+		return true;
+	}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+	validateWalkGrid();
+	return !isRegionWalkableAtCached(x, y);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
+	if (checkFreeObjects && isBlockedByFreeObjectAt(x, y, requester)) {
+		return false;
+	}
+
+	validateWalkGrid();
+	return isRegionWalkableAtCached(x, y);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedByFreeObjectAt(int x, int y, BaseObject *requester) const {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
 			}
 		}
 	}
+	return false;
+}
 
 
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isRegionWalkableAt(int x, int y) const {
+	bool ret = false;
+
 	if (_mainLayer) {
 		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
 			AdSceneNode *node = _mainLayer->_nodes[i];
-			/*
-			if (Node->_type == OBJECT_REGION && Node->_region->_active && Node->_region->_blocked && Node->_region->PointInRegion(X, Y))
-			{
-			    ret = true;
-			    break;
-			}
-			*/
 			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
 				if (node->_region->isBlocked()) {
-					ret = true;
+					ret = false;
 					break;
 				} else {
-					ret = false;
+					ret = true;
 				}
 			}
 		}
@@ -407,42 +425,108 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 
 
 //////////////////////////////////////////////////////////////////////////
-bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = false;
+bool AdScene::isRegionWalkableAtCached(int x, int y) {
+	if (x < 0 || y < 0) {
+		return isRegionWalkableAt(x, y);
+	}
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
+	int32 tileX = x / kWalkGridTileSize;
+	int32 tileY = y / kWalkGridTileSize;
+	if (tileX >= _walkGridTilesX || tileY >= _walkGridTilesY) {
+		return isRegionWalkableAt(x, y);
+	}
+
+	int32 tile = tileY * _walkGridTilesX + tileX;
+	if (!_walkGridTileReady[tile]) {
+		rasterizeWalkGridTile(tileX, tileY);
+	}
+
+	uint32 row = _walkGrid[tile * kWalkGridTileSize + y % kWalkGridTileSize];
+	return (row >> (x % kWalkGridTileSize)) & 1;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::rasterizeWalkGridTile(int32 tileX, int32 tileY) {
+	int32 left = tileX * kWalkGridTileSize;
+	int32 top = tileY * kWalkGridTileSize;
+	int32 right = left + kWalkGridTileSize - 1;
+	int32 bottom = top + kWalkGridTileSize - 1;
+
+	// Only the regions overlapping the tile can affect it, in the same order
+	// as isRegionWalkableAt() visits them
+	Common::Array<AdRegion *> regions;
+	for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+		AdSceneNode *node = _mainLayer->_nodes[i];
+		if (node->_type != OBJECT_REGION || !node->_region->_active || node->_region->hasDecoration()) {
+			continue;
 		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
+		const Rect32 &rect = node->_region->_rect;
+		if (rect.left <= right && rect.right >= left && rect.top <= bottom && rect.bottom >= top) {
+			regions.push_back(node->_region);
 		}
 	}
 
-
-	if (_mainLayer) {
-		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
-			AdSceneNode *node = _mainLayer->_nodes[i];
-			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
-				if (node->_region->isBlocked()) {
-					ret = false;
-					break;
-				} else {
-					ret = true;
+	int32 tile = tileY * _walkGridTilesX + tileX;
+	uint32 *rows = &_walkGrid[tile * kWalkGridTileSize];
+	for (int32 y = 0; y < kWalkGridTileSize; y++) {
+		uint32 bits = 0;
+		if (!regions.empty()) {
+			for (int32 x = 0; x < kWalkGridTileSize; x++) {
+				bool walkable = false;
+				for (uint32 i = 0; i < regions.size(); i++) {
+					if (regions[i]->pointInRegion(left + x, top + y)) {
+						if (regions[i]->isBlocked()) {
+							walkable = false;
+							break;
+						}
+						walkable = true;
+					}
+				}
+				if (walkable) {
+					bits |= 1u << x;
 				}
 			}
 		}
+		rows[y] = bits;
+	}
+	_walkGridTileReady[tile] = true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::invalidateWalkGrid() {
+	_walkGrid.clear();
+	_walkGridTileReady.clear();
+	_walkGridTilesX = _walkGridTilesY = 0;
+	_walkGridValid = false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::validateWalkGrid() {
+	if (_walkGridValid && _walkGridGeneration == BaseRegion::getGeneration() && _walkGridLayer == _mainLayer &&
+		(!_mainLayer || (_walkGridWidth == _mainLayer->_width && _walkGridHeight == _mainLayer->_height))) {
+		return;
+	}
+
+	invalidateWalkGrid();
+	_walkGridValid = true;
+	_walkGridGeneration = BaseRegion::getGeneration();
+	_walkGridLayer = _mainLayer;
+	_walkGridWidth = _mainLayer ? _mainLayer->_width : 0;
+	_walkGridHeight = _mainLayer ? _mainLayer->_height : 0;
+	if (!_mainLayer || _mainLayer->_width <= 0 || _mainLayer->_height <= 0) {
+		return;
+	}
+
+	_walkGridTilesX = (_mainLayer->_width + kWalkGridTileSize - 1) / kWalkGridTileSize;
+	_walkGridTilesY = (_mainLayer->_height + kWalkGridTileSize - 1) / kWalkGridTileSize;
+	_walkGrid.resize(_walkGridTilesX * _walkGridTilesY * kWalkGridTileSize);
+	_walkGridTileReady.resize(_walkGridTilesX * _walkGridTilesY);
+	for (uint32 i = 0; i < _walkGridTileReady.size(); i++) {
+		_walkGridTileReady[i] = false;
 	}
-	return ret;
 }
 
 
@@ -460,6 +544,24 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 	xLength = abs(x2 - x1);
 	yLength = abs(y2 - y1);
 
+	// Collect the free object block regions the line can hit once, instead
+	// of walking all objects for every pixel
+	_pfBlockRegions.clear();
+	int lineLeft = MIN(x1, x2), lineRight = MAX(x1, x2);
+	int lineTop = MIN(y1, y2), lineBottom = MAX(y1, y2);
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < _objects.size() + adGame->_objects.size(); i++) {
+		AdObject *obj = i < _objects.size() ? _objects[i] : adGame->_objects[i - _objects.size()];
+		if (obj->_active && obj != requester && obj->_currentBlockRegion) {
+			const Rect32 &rect = obj->_currentBlockRegion->_rect;
+			if (rect.left <= lineRight && rect.right >= lineLeft && rect.top <= lineBottom && rect.bottom >= lineTop) {
+				_pfBlockRegions.push_back(obj->_currentBlockRegion);
+			}
+		}
+	}
+
+	validateWalkGrid();
+
 	if (xLength > yLength) {
 		if (x1 > x2) {
 			BaseUtils::swap(&x1, &x2);
@@ -470,7 +572,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (isBlockedOnPathAt(xCount, (int)y)) {
 				return -1;
 			}
 			y += yStep;
@@ -485,7 +587,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (isBlockedOnPathAt((int)x, yCount)) {
 				return -1;
 			}
 			x += xStep;
@@ -495,6 +597,17 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedOnPathAt(int x, int y) {
+	for (uint32 i = 0; i < _pfBlockRegions.size(); i++) {
+		if (_pfBlockRegions[i]->pointInRegion(x, y)) {
+			return true;
+		}
+	}
+	return !isRegionWalkableAtCached(x, y);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
 	int i;
@@ -2962,6 +3075,10 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferPtr(TMEMBER_PTR(_viewport));
 	persistMgr->transferSint32(TMEMBER(_width));
 
+	if (!persistMgr->getIsSaving()) {
+		invalidateWalkGrid();
+	}
+
 #ifdef ENABLE_WME3D
 	if (BaseEngine::instance().getFlags() & GF_3D) {
 		persistMgr->transferPtr(TMEMBER(_sceneGeometry));
@@ -3351,6 +3468,7 @@ bool AdScene::persistState(bool saving) {
 						nodeState->_active = node->_region->_active;
 					} else {
 						node->_region->_active = nodeState->_active;
+						BaseRegion::bumpGeneration();
 					}
 				}
 				break;
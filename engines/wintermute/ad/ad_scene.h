@@ -38,6 +38,7 @@ class AdRegion;
 class BaseViewport;
 class AdLayer;
 class BasePoint;
+class BaseRegion;
 class AdWaypointGroup;
 class AdPath;
 class AdScaleLevel;
@@ -192,6 +193,37 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	/**
+	 * Walkability of the main layer regions, one bit per pixel. The layer is
+	 * split into tiles of kWalkGridTileSize pixels square which are rasterized
+	 * the first time they are queried. Free object block regions are not part
+	 * of the grid, as they move around; they are checked separately.
+	 */
+	enum {
+		kWalkGridTileSize = 32
+	};
+	Common::Array<uint32> _walkGrid;
+	Common::Array<bool> _walkGridTileReady;
+	int32 _walkGridTilesX;
+	int32 _walkGridTilesY;
+	/** What the grid was built from, to tell when it is stale */
+	bool _walkGridValid;
+	uint32 _walkGridGeneration;
+	AdLayer *_walkGridLayer;
+	int32 _walkGridWidth;
+	int32 _walkGridHeight;
+	/** Block regions of the free objects, collected once per getPointsDist() */
+	Common::Array<BaseRegion *> _pfBlockRegions;
+
+	void invalidateWalkGrid();
+	void validateWalkGrid();
+	void rasterizeWalkGridTile(int32 tileX, int32 tileY);
+	bool isRegionWalkableAt(int x, int y) const;
+	bool isRegionWalkableAtCached(int x, int y);
+	bool isBlockedByFreeObjectAt(int x, int y, BaseObject *requester) const;
+	/** isBlockedAt() for getPointsDist(), using the collected _pfBlockRegions */
+	bool isBlockedOnPathAt(int x, int y);
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
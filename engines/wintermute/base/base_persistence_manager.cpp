@@ -417,12 +417,21 @@ bool BasePersistenceManager::initLoad(const Common::String &filename) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+uint32 BasePersistenceManager::getSaveSize() const {
+	if (!_saving || !_saveStream) {
+		return 0;
+	}
+	return _saveStream->size();
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool BasePersistenceManager::saveFile(const Common::String &filename) {
 	byte *prefixBuffer = _richBuffer;
 	uint32 prefixSize = _richBufferSize;
-	byte *buffer = ((Common::MemoryWriteStreamDynamic *)_saveStream)->getData();
-	uint32 bufferSize = ((Common::MemoryWriteStreamDynamic *)_saveStream)->size();
+	byte *buffer = _saveStream->getData();
+	uint32 bufferSize = _saveStream->size();
 
 	Common::SaveFileManager *saveMan = ((WintermuteEngine *)g_engine)->getSaveFileMan();
 	Common::OutSaveFile *file = saveMan->openForSaving(filename);
@@ -32,6 +32,7 @@
 #include "engines/wintermute/dctypes.h"
 #include "engines/wintermute/math/rect32.h"
 #include "engines/savestate.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/str.h"
 #include "common/system.h"
@@ -79,6 +80,8 @@ public:
 	uint32 _offset;
 
 	bool getIsSaving() { return _saving; }
+	/** Number of bytes serialized so far */
+	uint32 getSaveSize() const;
 	TimeDate getSavedTimestamp() { return _savedTimestamp; }
 
 	uint32 _richBufferSize;
@@ -116,7 +119,7 @@ private:
 	bool readHeader(const Common::String &filename);
 	TimeDate getTimeDate();
 	bool putTimeDate(const TimeDate &t);
-	Common::WriteStream *_saveStream;
+	Common::MemoryWriteStreamDynamic *_saveStream;
 	Common::SeekableReadStream *_loadStream;
 	TimeDate _savedTimestamp;
 	uint32 _savedPlayTime;
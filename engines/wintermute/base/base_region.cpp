@@ -40,6 +40,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseRegion, false)
 
+uint32 BaseRegion::_generation = 0;
+
 //////////////////////////////////////////////////////////////////////////
 BaseRegion::BaseRegion(BaseGame *inGame) : BaseObject(inGame) {
 	_active = true;
@@ -66,11 +68,13 @@ void BaseRegion::cleanup() {
 
 	_rect.setEmpty();
 	_editorSelectedPoint = -1;
+	bumpGeneration();
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::createRegion() {
+	bumpGeneration();
 	return DID_SUCCEED(getBoundingRect(&_rect));
 }
 
@@ -383,6 +387,7 @@ bool BaseRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Active") == 0) {
 		_active = value->getBool();
+		bumpGeneration();
 		return STATUS_OK;
 	} else {
 		return BaseObject::scSetProperty(name, value);
@@ -439,6 +444,10 @@ bool BaseRegion::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferSint32(TMEMBER(_lastMimicY));
 	_points.persist(persistMgr);
 
+	if (!persistMgr->getIsSaving()) {
+		bumpGeneration();
+	}
+
 	return STATUS_OK;
 }
 
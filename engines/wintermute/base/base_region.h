@@ -46,6 +46,13 @@ public:
 	~BaseRegion() override;
 	bool pointInRegion(int x, int y);
 	bool createRegion();
+	/**
+	 * Bumped whenever the shape or state of any region changes, or regions
+	 * are added to or removed from a layer. Scenes compare it against the
+	 * value their walkability grid was built with.
+	 */
+	static uint32 getGeneration() { return _generation; }
+	static void bumpGeneration() { _generation++; }
 	bool loadFile(const char *filename);
 	bool loadBuffer(char *buffer, bool complete = true);
 	Rect32 _rect;
@@ -64,6 +71,7 @@ private:
 	float _lastMimicScale;
 	int32 _lastMimicX;
 	int32 _lastMimicY;
+	static uint32 _generation;
 };
 
 } // End of namespace Wintermute
@@ -41,6 +41,8 @@ namespace Wintermute {
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+	_unusedSurfaceCount = 0;
+	_unusedSurfaceSize = 0;
 }
 
 
@@ -53,12 +55,16 @@ BaseSurfaceStorage::~BaseSurfaceStorage() {
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::cleanup(bool warn) {
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (warn) {
+		if (warn && _surfaces[i]->_referenceCount > 0) {
 			BaseEngine::LOG(0, "BaseSurfaceStorage warning: purging surface '%s', usage:%d", _surfaces[i]->getFileName(), _surfaces[i]->_referenceCount);
 		}
 		delete _surfaces[i];
 	}
 	_surfaces.clear();
+	_surfaceIndex.clear();
+	_unusedSurfaces.clear();
+	_unusedSurfaceCount = 0;
+	_unusedSurfaceSize = 0;
 
 	return STATUS_OK;
 }
@@ -90,8 +96,25 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
-				delete _surfaces[i];
-				_surfaces.remove_at(i);
+				SurfaceIndex::iterator it = _surfaceIndex.find(surface->getFileName());
+
+				// Savegame thumbnails change when a slot is overwritten, so
+				// never keep them around under their name
+				Common::String filename = surface->getFileNameStr();
+				if (filename.hasPrefixIgnoreCase("savegame:") || it == _surfaceIndex.end() || it->_value._surface != surface) {
+					deleteSurface(surface);
+					break;
+				}
+
+				UnusedSurface unused;
+				unused._surface = surface;
+				unused._params = it->_value._params;
+				// Surfaces which were never decoded take no memory
+				unused._size = surface->getDecodedSize();
+				_unusedSurfaces.push_back(unused);
+				_unusedSurfaceCount++;
+				_unusedSurfaceSize += unused._size;
+				trimUnusedSurfaces();
 			}
 			break;
 		}
@@ -101,12 +124,72 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 
 
 //////////////////////////////////////////////////////////////////////
-BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
+void BaseSurfaceStorage::deleteSurface(BaseSurface *surface) {
+	SurfaceIndex::iterator it = _surfaceIndex.find(surface->getFileName());
+	if (it != _surfaceIndex.end() && it->_value._surface == surface) {
+		_surfaceIndex.erase(it);
+	}
+
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
-			_surfaces[i]->_referenceCount++;
-			return _surfaces[i];
+		if (_surfaces[i] == surface) {
+			_surfaces.remove_at(i);
+			break;
+		}
+	}
+	delete surface;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::reuseSurface(BaseSurface *surface, const SurfaceParams &params) {
+	for (Common::List<UnusedSurface>::iterator it = _unusedSurfaces.begin(); it != _unusedSurfaces.end(); ++it) {
+		if (it->_surface == surface) {
+			bool match = it->_params == params;
+			_unusedSurfaceCount--;
+			_unusedSurfaceSize -= it->_size;
+			_unusedSurfaces.erase(it);
+			return match;
+		}
+	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::trimUnusedSurfaces() {
+	while (_unusedSurfaceCount > kMaxUnusedSurfaces || _unusedSurfaceSize > kUnusedSurfaceBudget) {
+		UnusedSurface unused = _unusedSurfaces.front();
+		_unusedSurfaces.pop_front();
+		_unusedSurfaceCount--;
+		_unusedSurfaceSize -= unused._size;
+		deleteSurface(unused._surface);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////
+BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
+	SurfaceParams params;
+	params._defaultCK = defaultCK;
+	params._ckRed = ckRed;
+	params._ckGreen = ckGreen;
+	params._ckBlue = ckBlue;
+	params._lifeTime = lifeTime;
+	params._keepLoaded = keepLoaded;
+
+	SurfaceIndex::iterator it = _surfaceIndex.find(filename);
+	if (it != _surfaceIndex.end()) {
+		BaseSurface *surface = it->_value._surface;
+		if (surface->_referenceCount > 0) {
+			surface->_referenceCount++;
+			return surface;
+		}
+		if (reuseSurface(surface, params)) {
+			surface->_referenceCount = 1;
+			return surface;
 		}
+		// Released, but created with different parameters
+		deleteSurface(surface);
 	}
 
 	if (!BaseFileManager::getEngineInstance()->hasFile(filename)) {
@@ -133,6 +216,9 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 	} else {
 		surface->_referenceCount = 1;
 		_surfaces.push_back(surface);
+		IndexEntry &entry = _surfaceIndex[surface->getFileName()];
+		entry._surface = surface;
+		entry._params = params;
 		return surface;
 	}
 }
@@ -30,6 +30,9 @@
 
 #include "engines/wintermute/base/base.h"
 #include "common/array.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/list.h"
 
 namespace Wintermute {
 class BaseSurface;
@@ -49,6 +52,58 @@ public:
 	~BaseSurfaceStorage() override;
 
 	Common::Array<BaseSurface *> _surfaces;
+
+private:
+	/**
+	 * Surfaces which are no longer referenced are kept around, least recently
+	 * released first, so that a scene loading the same images again does not
+	 * have to decode them. They are deleted once they take more than
+	 * kUnusedSurfaceBudget bytes, or there are more than kMaxUnusedSurfaces.
+	 */
+	enum {
+		kUnusedSurfaceBudget = 32 * 1024 * 1024,
+		kMaxUnusedSurfaces = 256
+	};
+
+	/** The addSurface() arguments a surface was created with */
+	struct SurfaceParams {
+		bool _defaultCK;
+		byte _ckRed;
+		byte _ckGreen;
+		byte _ckBlue;
+		int _lifeTime;
+		bool _keepLoaded;
+
+		bool operator==(const SurfaceParams &other) const {
+			return _defaultCK == other._defaultCK && _ckRed == other._ckRed && _ckGreen == other._ckGreen &&
+				_ckBlue == other._ckBlue && _lifeTime == other._lifeTime && _keepLoaded == other._keepLoaded;
+		}
+	};
+
+	/**
+	 * A released surface is only handed out again if it is requested with
+	 * the same parameters it was created with; otherwise it is re-created.
+	 */
+	struct UnusedSurface {
+		BaseSurface *_surface;
+		SurfaceParams _params;
+		uint32 _size;
+	};
+
+	struct IndexEntry {
+		BaseSurface *_surface;
+		SurfaceParams _params;
+	};
+
+	typedef Common::HashMap<Common::String, IndexEntry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SurfaceIndex;
+	SurfaceIndex _surfaceIndex;
+	Common::List<UnusedSurface> _unusedSurfaces;
+	uint32 _unusedSurfaceCount;
+	uint32 _unusedSurfaceSize;
+
+	void deleteSurface(BaseSurface *surface);
+	bool reuseSurface(BaseSurface *surface, const SurfaceParams &params);
+	void trimUnusedSurfaces();
 };
 
 } // End of namespace Wintermute
@@ -76,6 +76,10 @@ public:
 	virtual int getHeight() {
 		return _height;
 	}
+	/** Memory taken by the decoded pixels, or 0 if the surface was never decoded */
+	uint32 getDecodedSize() const {
+		return _width * _height * 4;
+	}
 	Common::String getFileNameStr() { return _filename; }
 	const char* getFileName() { return _filename.c_str(); }
 	//void SetWidth(int Width) { _width = Width;    }
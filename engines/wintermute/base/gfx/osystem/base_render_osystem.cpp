@@ -74,6 +74,8 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_ticketIndex.clear();
+	_ownerTicketCount.clear();
 
 	delete _dirtyRect;
 
@@ -181,7 +183,7 @@ bool BaseRenderOSystem::flip() {
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
+				it = unqueueTicket(it);
 				delete ticket;
 			} else {
 				(*it)->_wantsDraw = false;
@@ -290,7 +292,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	if (_disableDirtyRects) {
 		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(ticket);
 		drawFromSurface(ticket);
 		return;
 	}
@@ -302,32 +304,14 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
-			}
+		RenderQueueIterator it;
+		if (findQueuedTicket(compare, it)) {
+			drawFromQueuedTicket(it);
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
-	if (!_disableDirtyRects) {
-		drawFromTicket(ticket);
-	} else {
-		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
-		drawFromSurface(ticket);
-	}
+	drawFromTicket(ticket);
 }
 
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
@@ -337,6 +321,9 @@ void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
+	if (!_ownerTicketCount.contains(surf)) {
+		return;
+	}
 	RenderQueueIterator it;
 	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 		if ((*it)->_owner == surf) {
@@ -351,15 +338,11 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	++_lastFrameIter;
 	// In-order
 	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
-		_lastFrameIter--;
-		_renderQueue.push_back(renderTicket);
-		++_lastFrameIter;
+		_lastFrameIter = queueTicket(renderTicket);
 		addDirtyRect(renderTicket->_dstRect);
 	} else {
 		// Before something
-		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
-		--_lastFrameIter;
+		_lastFrameIter = queueTicket(_lastFrameIter, renderTicket);
 		addDirtyRect(renderTicket->_dstRect);
 	}
 }
@@ -375,12 +358,84 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
-		_renderQueue.erase(ticket);
+		unqueueTicket(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
 	}
 }
 
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::queueTicket(RenderTicket *renderTicket) {
+	return queueTicket(_renderQueue.end(), renderTicket);
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket) {
+	_renderQueue.insert(pos, renderTicket);
+	RenderQueueIterator it = pos;
+	--it;
+
+	_ticketIndex[renderTicket->getHash()].push_back(it);
+	_ownerTicketCount[renderTicket->_owner]++;
+	return it;
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::unqueueTicket(const RenderQueueIterator &ticket) {
+	RenderTicket *renderTicket = *ticket;
+
+	RenderTicketIndex::iterator bucket = _ticketIndex.find(renderTicket->getHash());
+	assert(bucket != _ticketIndex.end());
+	Common::Array<RenderQueueIterator> &entries = bucket->_value;
+	for (uint i = 0; i < entries.size(); i++) {
+		if (entries[i] == ticket) {
+			// The order within a bucket doesn't matter
+			entries[i] = entries.back();
+			entries.pop_back();
+			break;
+		}
+	}
+	if (entries.empty()) {
+		_ticketIndex.erase(bucket);
+	}
+
+	uint &ownerCount = _ownerTicketCount[renderTicket->_owner];
+	if (--ownerCount == 0) {
+		_ownerTicketCount.erase(renderTicket->_owner);
+	}
+
+	return _renderQueue.erase(ticket);
+}
+
+bool BaseRenderOSystem::findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &result) {
+	RenderTicketIndex::const_iterator bucket = _ticketIndex.find(compare.getHash());
+	if (bucket == _ticketIndex.end()) {
+		return false;
+	}
+
+	// Tickets that were already drawn this frame are those up to _lastFrameIter,
+	// so only the ones that don't want to be drawn yet are candidates.
+	const Common::Array<RenderQueueIterator> &entries = bucket->_value;
+	uint matches = 0;
+	for (uint i = 0; i < entries.size(); i++) {
+		RenderTicket *ticket = *entries[i];
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			result = entries[i];
+			matches++;
+		}
+	}
+
+	// Buckets are not kept in queue order, so if several identical tickets are
+	// queued, walk the queue to reuse the first one and keep the draw order.
+	if (matches > 1) {
+		for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+				result = it;
+				break;
+			}
+		}
+	}
+	return matches > 0;
+}
+
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 	if (!_dirtyRect) {
 		_dirtyRect = new Common::Rect(rect);
@@ -400,7 +455,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_wantsDraw == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+			it = unqueueTicket(it);
 			delete ticket;
 		} else {
 			++it;
@@ -460,7 +515,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_isValid == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+			it = unqueueTicket(it);
 			delete ticket;
 		} else {
 			++it;
@@ -588,6 +643,8 @@ void BaseRenderOSystem::endSaveLoad() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_ticketIndex.clear();
+	_ownerTicketCount.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
@@ -30,6 +30,9 @@
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
+#include "common/array.h"
+#include "common/hash-ptr.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
 #include "common/list.h"
 
@@ -54,6 +57,9 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * To avoid searching the whole queue for every draw-call, the queued tickets are
+ * indexed by a hash of their draw specifications (see RenderTicket::getHash()).
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -130,8 +136,36 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Add a ticket to the end of the queue, and to the ticket index.
+	 * @return iterator pointing to the ticket in the queue
+	 */
+	RenderQueueIterator queueTicket(RenderTicket *renderTicket);
+	/**
+	 * Insert a ticket into the queue before the given position, and add it to the ticket index.
+	 * @return iterator pointing to the ticket in the queue
+	 */
+	RenderQueueIterator queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket);
+	/**
+	 * Remove a ticket from the queue and the ticket index, without deleting it.
+	 * @return iterator pointing to the ticket following the removed one
+	 */
+	RenderQueueIterator unqueueTicket(const RenderQueueIterator &ticket);
+	/**
+	 * Look up a valid ticket from last frame that equals the given ticket, and was not drawn yet this frame.
+	 * @param compare the ticket to compare against
+	 * @param result receives the position of the ticket in the queue
+	 * @return true if such a ticket was found
+	 */
+	bool findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &result);
+
+	typedef Common::HashMap<uint32, Common::Array<RenderQueueIterator> > RenderTicketIndex;
+
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
+	RenderTicketIndex _ticketIndex;
+	/** The number of queued tickets per owner, to skip searching for tickets of surfaces that have none */
+	Common::HashMap<BaseSurfaceOSystem *, uint> _ownerTicketCount;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
@@ -77,6 +77,7 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	} else {
 		_surface = nullptr;
 	}
+	_hash = computeHash();
 }
 
 RenderTicket::~RenderTicket() {
@@ -97,6 +98,28 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
+uint32 RenderTicket::computeHash() const {
+	const uint32 values[] = {
+		(uint32)(size_t)_owner,
+		(uint32)(uint16)_dstRect.left | ((uint32)(uint16)_dstRect.top << 16),
+		(uint32)(uint16)_dstRect.right | ((uint32)(uint16)_dstRect.bottom << 16),
+		(uint32)(uint16)_srcRect.left | ((uint32)(uint16)_srcRect.top << 16),
+		(uint32)(uint16)_srcRect.right | ((uint32)(uint16)_srcRect.bottom << 16),
+		(uint32)_transform._angle,
+		(uint32)(uint16)_transform._zoom.x | ((uint32)(uint16)_transform._zoom.y << 16),
+		_transform._rgbaMod,
+		(uint32)_transform._flip | ((uint32)_transform._alphaDisable << 8)
+	};
+
+	// FNV-1a style mixing of the 32-bit words
+	uint32 hash = 2166136261U;
+	for (uint i = 0; i < ARRAYSIZE(values); i++) {
+		hash ^= values[i];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 	Graphics::TransparentSurface src(*getSurface(), false);
@@ -51,7 +51,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _hash(0) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -68,10 +68,18 @@ public:
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
+	/**
+	 * Hash over the draw specifications compared by operator==, so that
+	 * equal tickets have equal hashes.
+	 */
+	uint32 getHash() const { return _hash; }
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
+	uint32 _hash;
+
+	uint32 computeHash() const;
 };
 
 } // End of namespace Wintermute
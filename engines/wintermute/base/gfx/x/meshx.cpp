@@ -281,14 +281,9 @@ bool MeshX::update(FrameNode *parentFrame) {
 
 	//updateNormals();
 	} else { // update static
-		for (uint32 i = 0; i < _vertexCount; ++i) {
-			Math::Vector3d pos(_vertexPositionData + 3 * i);
-			parentFrame->getCombinedMatrix()->transform(&pos, true);
-
-			for (uint j = 0; j < 3; ++j) {
-				_vertexData[i * kVertexComponentCount + kPositionOffset + j] = pos.getData()[j];
-			}
-		}
+		parentFrame->getCombinedMatrix()->transform(_vertexPositionData, 3,
+		                                            _vertexData + kPositionOffset, kVertexComponentCount,
+		                                            _vertexCount, true);
 	}
 
 	updateBoundingBox();
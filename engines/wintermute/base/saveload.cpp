@@ -92,16 +92,21 @@ bool SaveLoad::saveGame(int slot, const char *desc, bool quickSave, BaseGame *ga
 
 	bool ret;
 
+	uint32 startTime = g_system->getMillis();
 	BasePersistenceManager *pm = new BasePersistenceManager();
 	if (DID_SUCCEED(ret = pm->initSave(desc))) {
 		gameRef->_renderer->initSaveLoad(true, quickSave); // TODO: The original code inited the indicator before the conditionals
 		if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveTable(gameRef,  pm, quickSave))) {
 			if (DID_SUCCEED(ret = SystemClassRegistry::getInstance()->saveInstances(gameRef,  pm, quickSave))) {
 				pm->putDWORD(BaseEngine::instance().getRandomSource()->getSeed());
+				uint32 serializeTime = g_system->getMillis();
 				if (DID_SUCCEED(ret = pm->saveFile(filename))) {
 					ConfMan.setInt("most_recent_saveslot", slot);
 					ConfMan.flushToDisk();
 				}
+				debugC(kWintermuteDebugSaveGame, "Saved %d bytes: serialized in %d ms, written in %d ms",
+				       pm->getSaveSize(), serializeTime - startTime, g_system->getMillis() - serializeTime);
+				logSaveStats();
 			}
 		}
 	}
@@ -113,6 +118,15 @@ bool SaveLoad::saveGame(int slot, const char *desc, bool quickSave, BaseGame *ga
 	return ret;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void SaveLoad::logSaveStats() {
+	const Common::Array<SystemClassRegistry::SaveStats> &stats = SystemClassRegistry::getInstance()->getSaveStats();
+	for (uint32 i = 0; i < stats.size(); i++) {
+		debugC(2, kWintermuteDebugSaveGame, "%10d bytes %6d instances %5d ms  %s",
+		       stats[i]._bytes, stats[i]._instances, stats[i]._millis, stats[i]._className.c_str());
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool SaveLoad::initAfterLoad() {
 	SystemClassRegistry::getInstance()->enumInstances(afterLoadRegion,   "BaseRegion",   nullptr);
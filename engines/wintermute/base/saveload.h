@@ -46,6 +46,7 @@ public:
 	static void afterLoadScene(void *scene, void *data);
 	static void afterLoadRegion(void *region, void *data);
 private:
+	static void logSaveStats();
 	static void afterLoadSubFrame(void *subframe, void *data);
 	static void afterLoadSound(void *sound, void *data);
 	static void afterLoadFont(void *font, void *data);
@@ -481,18 +481,22 @@ void ScScript::cleanup() {
 
 //////////////////////////////////////////////////////////////////////////
 uint32 ScScript::getDWORD() {
-	_scriptStream->seek((int32)_iP);
-	uint32 ret = _scriptStream->readUint32LE();
+	// Read straight from the buffer, this is called for every instruction
+	// and most operands, so going through the stream is too slow
+	uint32 ret = 0;
+	if (_iP + sizeof(uint32) <= _bufferSize) {
+		ret = READ_LE_UINT32(_buffer + _iP);
+	}
 	_iP += sizeof(uint32);
-//	assert(oldRet == ret);
 	return ret;
 }
 
 //////////////////////////////////////////////////////////////////////////
 double ScScript::getFloat() {
-	_scriptStream->seek((int32)_iP);
-	byte buffer[8];
-	_scriptStream->read(buffer, 8);
+	byte buffer[8] = { 0 };
+	if (_iP + 8 <= _bufferSize) {
+		memcpy(buffer, _buffer + _iP, 8);
+	}
 
 #ifdef SCUMM_BIG_ENDIAN
 	// TODO: For lack of a READ_LE_UINT64
@@ -516,7 +520,6 @@ char *ScScript::getString() {
 		_iP++;
 	}
 	_iP++; // string terminator
-	_scriptStream->seek(_iP);
 
 	return ret;
 }
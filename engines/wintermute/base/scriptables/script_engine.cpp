@@ -34,6 +34,8 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
 
+#include "common/algorithm.h"
+
 namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScEngine, true)
@@ -351,12 +353,14 @@ bool ScEngine::tick() {
 		// time sliced script
 		if (_scripts[i]->_timeSlice > 0) {
 			uint32 startTime = g_system->getMillis();
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (_isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 
@@ -368,12 +372,14 @@ bool ScEngine::tick() {
 				startTime = g_system->getMillis();
 			}
 
+			uint32 instructions = 0;
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (isProfiling && _scripts[i]->_filename) {
-				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
+				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime, instructions);
 			}
 		}
 		_currentScript = nullptr;
@@ -582,14 +588,46 @@ bool ScEngine::clearGlobals(bool includingNatives) {
 }
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::addScriptTime(const char *filename, uint32 time) {
+void ScEngine::addScriptTime(const char *filename, uint32 time, uint32 instructions) {
 	if (!_isProfiling) {
 		return;
 	}
 
 	AnsiString fileName = filename;
 	fileName.toLowercase();
-	_scriptTimes[fileName] += time;
+	ScriptProfile &profile = _scriptProfiles[fileName];
+	profile.millis += time;
+	profile.instructions += instructions;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+static bool scriptProfileGreater(const ScEngine::ScriptProfile &a, const ScEngine::ScriptProfile &b) {
+	if (a.millis != b.millis) {
+		return a.millis > b.millis;
+	}
+	return a.instructions > b.instructions;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+Common::Array<ScEngine::ScriptProfile> ScEngine::getScriptProfiles() const {
+	Common::Array<ScriptProfile> profiles;
+	for (ScriptProfiles::const_iterator it = _scriptProfiles.begin(); it != _scriptProfiles.end(); ++it) {
+		profiles.push_back(it->_value);
+		profiles.back().filename = it->_key;
+	}
+	Common::sort(profiles.begin(), profiles.end(), scriptProfileGreater);
+	return profiles;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+uint32 ScEngine::getProfilingTime() const {
+	if (!_isProfiling) {
+		return 0;
+	}
+	return g_system->getMillis() - _profilingStartTime;
 }
 
 
@@ -600,7 +638,7 @@ void ScEngine::enableProfiling() {
 	}
 
 	// destroy old data, if any
-	_scriptTimes.clear();
+	_scriptProfiles.clear();
 
 	_profilingStartTime = g_system->getMillis();
 	_isProfiling = true;
@@ -620,27 +658,16 @@ void ScEngine::disableProfiling() {
 
 //////////////////////////////////////////////////////////////////////////
 void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+	uint32 totalTime = getProfilingTime();
+	Common::Array<ScriptProfile> profiles = getScriptProfiles();
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
-
-
-	    TimeVector::reverse_iterator tit;
-
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
-
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	for (uint i = 0; i < profiles.size(); i++) {
+		_gameRef->LOG(0, "  %-40s %fs (%f%%), %u instructions", profiles[i].filename.c_str(), (float)profiles[i].millis / 1000,
+		              totalTime ? (float)profiles[i].millis / (float)totalTime * 100 : 0.0f, profiles[i].instructions);
+	}
 }
 
 } // End of namespace Wintermute
@@ -102,7 +102,22 @@ public:
 		return _isProfiling;
 	}
 
-	void addScriptTime(const char *filename, uint32 Time);
+	/** Execution statistics of a script file, collected while profiling */
+	struct ScriptProfile {
+		Common::String filename;
+		uint32 millis;
+		uint32 instructions;
+
+		ScriptProfile() : millis(0), instructions(0) {}
+	};
+
+	void addScriptTime(const char *filename, uint32 time, uint32 instructions);
+	/**
+	 * Get the statistics collected since profiling was enabled,
+	 * sorted by descending execution time.
+	 */
+	Common::Array<ScriptProfile> getScriptProfiles() const;
+	uint32 getProfilingTime() const;
 	void dumpStats();
 
 private:
@@ -111,8 +126,8 @@ private:
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
-	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
-	ScriptTimes _scriptTimes;
+	typedef Common::HashMap<Common::String, ScriptProfile> ScriptProfiles;
+	ScriptProfiles _scriptProfiles;
 
 };
 
@@ -24,6 +24,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/debugger/debugger_controller.h"
+#include "engines/wintermute/system/sys_class_registry.h"
 #include "engines/wintermute/wintermute.h"
 
 #define CONTROLLER _engineRef->_dbgController
@@ -35,6 +36,8 @@ Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd(PROFILE_CMD, WRAP_METHOD(Console, Cmd_Profile));
+	registerCmd("save_stats", WRAP_METHOD(Console, Cmd_SaveStats));
 	registerCmd("help", WRAP_METHOD(Console, Cmd_Help));
 	// Actual (script) debugger commands
 	registerCmd(STEP_CMD, WRAP_METHOD(Console, Cmd_Step));
@@ -99,6 +102,8 @@ void Console::printUsage(const Common::String &command) {
 		debugPrintf("Usage: %s <name> to print value of <name>\n", command.c_str());
 	} else if (command.equals(SET_CMD)) {
 		debugPrintf("Usage: %s <name> = <value> to set <name> to <value>\n", command.c_str());
+	} else if (command.equals(PROFILE_CMD)) {
+		debugPrintf("Usage: %s [on|off|show [count]] to control script profiling or show the statistics\n", command.c_str());
 	} else {
 		debugPrintf("No help about this command, sorry.");
 	}
@@ -307,6 +312,53 @@ bool Console::Cmd_ShowFps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_Profile(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "on")) {
+		CONTROLLER->setProfiling(true);
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		CONTROLLER->setProfiling(false);
+	} else if ((argc == 2 || argc == 3) && !strcmp(argv[1], "show")) {
+		if (!CONTROLLER->isProfiling()) {
+			debugPrintf("%s: profiling is not enabled\n", argv[0]);
+			return true;
+		}
+		uint count = (argc == 3) ? atoi(argv[2]) : 20;
+		uint32 totalTime;
+		Common::Array<ProfileEntry> entries = CONTROLLER->getProfile(totalTime);
+		debugPrintf("Total time: %d ms\n", totalTime);
+		for (uint i = 0; i < entries.size() && i < count; i++) {
+			debugPrintf("%8d ms %10d instr  %s\n", entries[i].millis, entries[i].instructions, entries[i].filename.c_str());
+		}
+	} else {
+		printUsage(argv[0]);
+	}
+	return true;
+}
+
+bool Console::Cmd_SaveStats(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [count]\n", argv[0]);
+		return true;
+	}
+
+	const Common::Array<SystemClassRegistry::SaveStats> &stats = SystemClassRegistry::getInstance()->getSaveStats();
+	if (stats.empty()) {
+		debugPrintf("No game has been saved yet\n");
+		return true;
+	}
+
+	uint count = (argc == 2) ? atoi(argv[1]) : 20;
+	uint32 totalBytes = 0;
+	for (uint i = 0; i < stats.size(); i++) {
+		totalBytes += stats[i]._bytes;
+	}
+	debugPrintf("Total: %d bytes in %d classes\n", totalBytes, stats.size());
+	for (uint i = 0; i < stats.size() && i < count; i++) {
+		debugPrintf("%10d bytes %6d instances %5d ms  %s\n", stats[i]._bytes, stats[i]._instances, stats[i]._millis, stats[i]._className.c_str());
+	}
+	return true;
+}
+
 bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	if (argc != 3) {
 		debugPrintf("Usage: %s <file path> <output file name>\n", argv[0]);
@@ -52,6 +52,7 @@
 #define PRINT_CMD "print"
 #define SET_PATH_CMD "set_path"
 #define TOP_CMD "top"
+#define PROFILE_CMD "profile"
 
 namespace Wintermute {
 class WintermuteEngine;
@@ -69,6 +70,16 @@ public:
 	bool Cmd_Help(int argc, const char **argv);
 	bool Cmd_ShowFps(int argc, const char **argv);
 	bool Cmd_DumpFile(int argc, const char **argv);
+	/**
+	 * Control script profiling, and print the execution time
+	 * and instruction count of each script file
+	 */
+	bool Cmd_Profile(int argc, const char **argv);
+	/**
+	 * Print the size and save time of each persistent class
+	 * during the last save
+	 */
+	bool Cmd_SaveStats(int argc, const char **argv);
 
 #if EXTENDED_DEBUGGER_ENABLED
 	/**
@@ -27,6 +27,7 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/debugger/breakpoint.h"
@@ -259,6 +260,35 @@ void DebuggerController::showFps(bool show) {
 	_engine->_game->setShowFPS(show);
 }
 
+void DebuggerController::setProfiling(bool enable) {
+	assert(SCENGINE);
+	if (enable) {
+		SCENGINE->enableProfiling();
+	} else {
+		SCENGINE->disableProfiling();
+	}
+}
+
+bool DebuggerController::isProfiling() const {
+	assert(SCENGINE);
+	return SCENGINE->getIsProfiling();
+}
+
+Common::Array<ProfileEntry> DebuggerController::getProfile(uint32 &totalTime) const {
+	assert(SCENGINE);
+	Common::Array<ProfileEntry> res;
+	Common::Array<ScEngine::ScriptProfile> profiles = SCENGINE->getScriptProfiles();
+	for (uint i = 0; i < profiles.size(); i++) {
+		ProfileEntry entry;
+		entry.filename = profiles[i].filename;
+		entry.millis = profiles[i].millis;
+		entry.instructions = profiles[i].instructions;
+		res.push_back(entry);
+	}
+	totalTime = SCENGINE->getProfilingTime();
+	return res;
+}
+
 Common::Array<BreakpointInfo> DebuggerController::getBreakpoints() const {
 	assert(SCENGINE);
 	Common::Array<BreakpointInfo> breakpoints;
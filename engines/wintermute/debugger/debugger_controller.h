@@ -49,6 +49,12 @@ struct WatchInfo {
 	bool _enabled;
 };
 
+struct ProfileEntry {
+	Common::String filename;
+	uint32 millis;
+	uint32 instructions;
+};
+
 struct TopEntry {
 	bool current;
 	Common::String filename;
@@ -105,6 +111,16 @@ public:
 	Common::String getSourcePath() const;
 	Listing *getListing(Error* &err);
 	void showFps(bool show);
+	/**
+	 * @brief enable or disable script profiling. Disabling it dumps the statistics to the log.
+	 */
+	void setProfiling(bool enable);
+	bool isProfiling() const;
+	/**
+	 * @brief get the per-script statistics collected since profiling was enabled, most expensive first
+	 * @param totalTime receives the time since profiling was enabled, in ms
+	 */
+	Common::Array<ProfileEntry> getProfile(uint32 &totalTime) const;
 	/**
 	 * Inherited from ScriptMonitor
 	 */
@@ -33,6 +33,7 @@
 #include "engines/wintermute/system/sys_class_registry.h"
 #include "engines/wintermute/system/sys_class.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/algorithm.h"
 #include "common/stream.h"
 
 namespace Wintermute {
@@ -248,6 +249,11 @@ bool SystemClassRegistry::loadTable(BaseGame *gameRef, BasePersistenceManager *p
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+static bool saveStatsLess(const SystemClassRegistry::SaveStats &s1, const SystemClassRegistry::SaveStats &s2) {
+	return s1._bytes > s2._bytes;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool SystemClassRegistry::saveInstances(BaseGame *gameRef, BasePersistenceManager *persistMgr, bool quickSave) {
 
@@ -261,6 +267,8 @@ bool SystemClassRegistry::saveInstances(BaseGame *gameRef, BasePersistenceManage
 
 	persistMgr->putDWORD(numInstances);
 
+	_saveStats.clear();
+
 	int counter = 0;
 	for (it = _classes.begin(); it != _classes.end(); ++it) {
 		counter++;
@@ -272,9 +280,22 @@ bool SystemClassRegistry::saveInstances(BaseGame *gameRef, BasePersistenceManage
 		}
 		gameRef->miniUpdate();
 
+		uint32 startSize = persistMgr->getSaveSize();
+		uint32 startTime = g_system->getMillis();
 		(it->_value)->saveInstances(gameRef,  persistMgr);
+
+		SaveStats stats;
+		stats._className = (it->_value)->getName();
+		stats._instances = (it->_value)->getNumInstances();
+		stats._bytes = persistMgr->getSaveSize() - startSize;
+		stats._millis = g_system->getMillis() - startTime;
+		if (stats._instances) {
+			_saveStats.push_back(stats);
+		}
 	}
 
+	Common::sort(_saveStats.begin(), _saveStats.end(), saveStatsLess);
+
 	return STATUS_OK;
 }
 
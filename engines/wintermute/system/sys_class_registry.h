@@ -31,6 +31,7 @@
 #include "engines/wintermute/wintypes.h"
 #include "engines/wintermute/dctypes.h"
 #include "engines/wintermute/system/sys_class.h"
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 #include "common/func.h"
@@ -83,6 +84,16 @@ public:
 	int getNextID();
 	void addInstanceToTable(SystemInstance *instance, void *pointer);
 
+	/** Output of one class during the last saveInstances() call */
+	struct SaveStats {
+		AnsiString _className;
+		uint32 _instances;
+		uint32 _bytes;
+		uint32 _millis;
+	};
+	/** Per class save statistics of the last save, largest first */
+	const Common::Array<SaveStats> &getSaveStats() const { return _saveStats; }
+
 	bool _disabled;
 	int _count;
 
@@ -101,6 +112,9 @@ public:
 	typedef Common::HashMap<int, SystemInstance *> SavedInstanceMap;
 	SavedInstanceMap _savedInstanceMap;
 
+private:
+	Common::Array<SaveStats> _saveStats;
+
 };
 
 } // End of namespace Wintermute
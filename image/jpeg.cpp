@@ -30,6 +30,7 @@
 #include "common/stream.h"
 #include "common/textconsole.h"
 #include "common/util.h"
+#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 
 #ifdef USE_JPEG
@@ -46,6 +47,7 @@ namespace Image {
 
 JPEGDecoder::JPEGDecoder() :
 		_surface(),
+		_conversionSurface(),
 		_colorSpace(kColorSpaceRGB),
 		_requestedPixelFormat(getByteOrderRgbPixelFormat()) {
 }
@@ -68,15 +70,24 @@ const Graphics::Surface *JPEGDecoder::getSurface() const {
 
 void JPEGDecoder::destroy() {
 	_surface.free();
+	_conversionSurface.free();
 }
 
 const Graphics::Surface *JPEGDecoder::decodeFrame(Common::SeekableReadStream &stream) {
-	if (!loadStream(stream))
+	// Video frames usually all have the same size, so the surface of the
+	// previous frame is decoded over instead of being reallocated.
+	if (!decodeImage(stream, _surface)) {
+		destroy();
 		return 0;
+	}
 
 	return getSurface();
 }
 
+bool JPEGDecoder::decodeInto(Common::SeekableReadStream &stream, Graphics::Surface &surface) {
+	return decodeImage(stream, surface);
+}
+
 Graphics::PixelFormat JPEGDecoder::getPixelFormat() const {
 	return _surface.format;
 }
@@ -227,11 +238,22 @@ J_COLOR_SPACE fromScummvmPixelFormat(const Graphics::PixelFormat &format) {
 } // End of anonymous namespace
 #endif
 
+void JPEGDecoder::reuseSurface(Graphics::Surface &surface, int16 width, int16 height, const Graphics::PixelFormat &format) {
+	if (!surface.getPixels() || surface.w != width || surface.h != height || surface.format != format) {
+		surface.free();
+		surface.create(width, height, format);
+	}
+}
+
 bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
-#ifdef USE_JPEG
 	// Reset member variables from previous decodings
 	destroy();
 
+	return decodeImage(stream, _surface);
+}
+
+bool JPEGDecoder::decodeImage(Common::SeekableReadStream &stream, Graphics::Surface &surface) {
+#ifdef USE_JPEG
 	jpeg_decompress_struct cinfo;
 	jpeg_error_mgr jerr;
 
@@ -275,46 +297,51 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	jpeg_start_decompress(&cinfo);
 
 	// Allocate buffers for the output data
+	Graphics::PixelFormat outputPixelFormat;
 	switch (_colorSpace) {
-	case kColorSpaceRGB: {
-		Graphics::PixelFormat outputPixelFormat;
+	case kColorSpaceRGB:
 		if (cinfo.out_color_space == JCS_RGB) {
 			outputPixelFormat = getByteOrderRgbPixelFormat();
 		} else {
 			outputPixelFormat = _requestedPixelFormat;
 		}
-		_surface.create(cinfo.output_width, cinfo.output_height, outputPixelFormat);
 		break;
-	}
 	case kColorSpaceYUV:
 		// We use YUV with 3 bytes per pixel otherwise.
 		// This is pretty ugly since our PixelFormat cannot express YUV...
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0));
+		outputPixelFormat = Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0);
 		break;
 	default:
 		break;
 	}
 
-	// Allocate buffer for one scanline
-	JDIMENSION pitch = cinfo.output_width * _surface.format.bytesPerPixel;
-	assert(_surface.pitch >= (int)pitch);
-	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
+	// When libjpeg cannot output the requested format, the image is decoded
+	// into a surface of the decoder, and converted from there. Both surfaces
+	// keep their format, so they can be reused for the next image.
+	bool needsConversion = _colorSpace == kColorSpaceRGB && outputPixelFormat != _requestedPixelFormat;
+	Graphics::Surface &decodeSurface = needsConversion ? _conversionSurface : surface;
+	reuseSurface(decodeSurface, cinfo.output_width, cinfo.output_height, outputPixelFormat);
 
-	// Go through the image data scanline by scanline
-	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
+	assert(decodeSurface.pitch >= (int)(cinfo.output_width * decodeSurface.format.bytesPerPixel));
 
-		jpeg_read_scanlines(&cinfo, buffer, 1);
+	// Go through the image data scanline by scanline, decoding straight
+	// into the surface
+	while (cinfo.output_scanline < cinfo.output_height) {
+		JSAMPROW row = (JSAMPROW)decodeSurface.getBasePtr(0, cinfo.output_scanline);
 
-		memcpy(dst, buffer[0], pitch);
+		jpeg_read_scanlines(&cinfo, &row, 1);
 	}
 
 	// We are done with decompressing, thus free all the data
 	jpeg_finish_decompress(&cinfo);
 	jpeg_destroy_decompress(&cinfo);
 
-	if (_colorSpace == kColorSpaceRGB && _surface.format != _requestedPixelFormat) {
-		_surface.convertToInPlace(_requestedPixelFormat); // Slow path
+	if (needsConversion) {
+		// Slow path
+		reuseSurface(surface, decodeSurface.w, decodeSurface.h, _requestedPixelFormat);
+		Graphics::crossBlit((byte *)surface.getPixels(), (const byte *)decodeSurface.getPixels(),
+		                    surface.pitch, decodeSurface.pitch, surface.w, surface.h,
+		                    surface.format, decodeSurface.format);
 	}
 
 	return true;
@@ -101,12 +101,29 @@ public:
 	 */
 	void setOutputPixelFormat(const Graphics::PixelFormat &format) { _requestedPixelFormat = format; }
 
+	/**
+	 * Decode an image into a surface owned by the caller, rather than into
+	 * the surface of the decoder. This avoids copying the image out of the
+	 * decoder when the caller needs to keep it.
+	 *
+	 * The surface is reused if it already has the size and format of the
+	 * decoded image, otherwise it is freed and allocated again.
+	 *
+	 * @param stream  The stream containing the JPEG image.
+	 * @param surface The surface to decode the image into.
+	 */
+	bool decodeInto(Common::SeekableReadStream &stream, Graphics::Surface &surface);
+
 private:
 	Graphics::Surface _surface;
+	/** The image in the format output by libjpeg, when it has to be converted */
+	Graphics::Surface _conversionSurface;
 	ColorSpace _colorSpace;
 	Graphics::PixelFormat _requestedPixelFormat;
 
 	Graphics::PixelFormat getByteOrderRgbPixelFormat() const;
+	bool decodeImage(Common::SeekableReadStream &stream, Graphics::Surface &surface);
+	static void reuseSurface(Graphics::Surface &surface, int16 width, int16 height, const Graphics::PixelFormat &format);
 };
 /** @} */
 } // End of namespace Image
@@ -34,15 +34,33 @@ Matrix<4, 4>::Matrix(const MatrixBase<4, 4> &m) :
 }
 
 void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
-	Vector4d m;
-	m(0, 0) = v->x();
-	m(1, 0) = v->y();
-	m(2, 0) = v->z();
-	m(3, 0) = (trans ? 1.f : 0.f);
+	transform(v->getData(), 3, v->getData(), 3, 1, trans);
+}
+
+void Matrix<4, 4>::transform(const float *in, uint inStride, float *out, uint outStride, uint count, bool trans) const {
+	const float *m = getData();
+	const float tx = trans ? m[3] : 0.f;
+	const float ty = trans ? m[7] : 0.f;
+	const float tz = trans ? m[11] : 0.f;
+
+	for (uint i = 0; i < count; ++i) {
+		const float x = in[0];
+		const float y = in[1];
+		const float z = in[2];
 
-	m = *this * m;
+		out[0] = m[0] * x + m[1] * y + m[2] * z + tx;
+		out[1] = m[4] * x + m[5] * y + m[6] * z + ty;
+		out[2] = m[8] * x + m[9] * y + m[10] * z + tz;
+
+		in += inStride;
+		out += outStride;
+	}
+}
 
-	v->set(m(0, 0), m(1, 0), m(2, 0));
+void Matrix<4, 4>::transform(const Vector3d *in, Vector3d *out, uint count, bool trans) const {
+	for (uint i = 0; i < count; ++i) {
+		transform(in[i].getData(), 3, out[i].getData(), 3, 1, trans);
+	}
 }
 
 Vector3d Matrix<4, 4>::getPosition() const {
@@ -40,6 +40,22 @@ public:
 
 	void transform(Vector3d *v, bool translate) const;
 
+	/**
+	 * Transforms an array of points, or of directions if translate is false.
+	 * The vectors are read as three consecutive floats, which allows to
+	 * transform interleaved vertex buffers in place.
+	 *
+	 * @param in        The first vector to transform
+	 * @param inStride  The distance in floats between two input vectors
+	 * @param out       Where to store the first transformed vector. It may
+	 *                  be the same as in.
+	 * @param outStride The distance in floats between two output vectors
+	 * @param count     The number of vectors to transform
+	 * @param translate Whether to apply the translation part of the matrix
+	 */
+	void transform(const float *in, uint inStride, float *out, uint outStride, uint count, bool translate) const;
+	void transform(const Vector3d *in, Vector3d *out, uint count, bool translate) const;
+
 	Vector3d getPosition() const;
 	void setPosition(const Vector3d &v);
 
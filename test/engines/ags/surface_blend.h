@@ -0,0 +1,159 @@
+#include <cxxtest/TestSuite.h>
+
+#include "engines/ags/lib/allegro/surface_blend.h"
+
+/**
+ * Checks the row blenders of engines/ags/lib/allegro/surface_blend.cpp
+ * against the per pixel blender functions of BITMAP, which are copied here
+ * working on separate channels, as in surface.h.
+ */
+class AgsSurfaceBlendTestSuite : public CxxTest::TestSuite {
+	uint32 _seed;
+
+	uint32 nextRandom() {
+		// xorshift32
+		_seed ^= _seed << 13;
+		_seed ^= _seed >> 17;
+		_seed ^= _seed << 5;
+		return _seed;
+	}
+
+	static void rgbBlend(uint8 rSrc, uint8 gSrc, uint8 bSrc, uint8 &rDest, uint8 &gDest, uint8 &bDest, uint32 alpha) {
+		if (alpha)
+			alpha++;
+
+		uint32 x = ((uint32)rSrc << 16) | ((uint32)gSrc << 8) | (uint32)bSrc;
+		uint32 y = ((uint32)rDest << 16) | ((uint32)gDest << 8) | (uint32)bDest;
+
+		uint32 res = ((x & 0xFF00FF) - (y & 0xFF00FF)) * alpha / 256 + y;
+		y &= 0xFF00;
+		x &= 0xFF00;
+		uint32 g = (x - y) * alpha / 256 + y;
+
+		rDest = (res >> 16) & 0xff;
+		gDest = (g >> 8) & 0xff;
+		bDest = res & 0xff;
+	}
+
+	static uint32 referenceBlend(AGS3::BlenderMode mode, uint32 src, uint32 dest, uint32 alpha) {
+		uint8 aSrc = src >> 24, rSrc = src >> 16, gSrc = src >> 8, bSrc = src;
+		uint8 aDest = dest >> 24, rDest = dest >> 16, gDest = dest >> 8, bDest = dest;
+
+		switch (mode) {
+		case AGS3::kRgbToRgbBlender:
+			rgbBlend(rSrc, gSrc, bSrc, rDest, gDest, bDest, alpha);
+			aDest = 0;
+			break;
+		case AGS3::kAlphaPreservedBlenderMode:
+			rgbBlend(rSrc, gSrc, bSrc, rDest, gDest, bDest, alpha);
+			break;
+		case AGS3::kSourceAlphaBlender:
+			rgbBlend(rSrc, gSrc, bSrc, rDest, gDest, bDest, aSrc);
+			aDest = 0;
+			break;
+		case AGS3::kArgbToRgbBlender:
+			if (alpha == 0)
+				alpha = aSrc;
+			else
+				alpha = aSrc * ((alpha & 0xff) + 1) / 256;
+			rgbBlend(rSrc, gSrc, bSrc, rDest, gDest, bDest, alpha);
+			aDest = 0;
+			break;
+		case AGS3::kOpaqueBlenderMode:
+			aDest = 0xff;
+			rDest = rSrc;
+			gDest = gSrc;
+			bDest = bSrc;
+			break;
+		case AGS3::kAdditiveBlenderMode:
+			rDest = rSrc;
+			gDest = gSrc;
+			bDest = bSrc;
+			aDest = MIN<uint32>((uint32)aSrc + (uint32)aDest, 0xff);
+			break;
+		default:
+			break;
+		}
+
+		return ((uint32)aDest << 24) | ((uint32)rDest << 16) | ((uint32)gDest << 8) | bDest;
+	}
+
+	void fillRow(uint32 *row, int count) {
+		for (int i = 0; i < count; ++i) {
+			uint32 pixel = nextRandom();
+			switch (nextRandom() % 8) {
+			case 0:
+				// Transparent color, with any alpha
+				pixel = (pixel & 0xFF000000) | 0xFF00FF;
+				break;
+			case 1:
+				pixel &= 0xFFFFFF;
+				break;
+			case 2:
+				pixel |= 0xFF000000;
+				break;
+			default:
+				break;
+			}
+			row[i] = pixel;
+		}
+	}
+
+	void checkMode(AGS3::BlenderMode mode, AGS3::BlendRowProc proc) {
+		const int kMaxCount = 37;
+		uint32 src[kMaxCount], dest[kMaxCount], expected[kMaxCount];
+
+		for (int iteration = 0; iteration < 2000; ++iteration) {
+			int count = nextRandom() % (kMaxCount + 1);
+			uint32 alpha = nextRandom() % 256;
+			bool skipTrans = nextRandom() & 1;
+			fillRow(src, count);
+			fillRow(dest, count);
+
+			for (int i = 0; i < count; ++i) {
+				if (skipTrans && (src[i] & 0xFFFFFF) == 0xFF00FF)
+					expected[i] = dest[i];
+				else
+					expected[i] = referenceBlend(mode, src[i], dest[i], alpha);
+			}
+
+			proc(dest, src, count, alpha, skipTrans);
+			for (int i = 0; i < count; ++i)
+				TS_ASSERT_EQUALS(dest[i], expected[i]);
+		}
+	}
+
+public:
+	AgsSurfaceBlendTestSuite() : _seed(0x12345678) {
+	}
+
+	void test_row_blenders() {
+		static const AGS3::BlenderMode modes[] = {
+			AGS3::kSourceAlphaBlender,
+			AGS3::kArgbToRgbBlender,
+			AGS3::kRgbToRgbBlender,
+			AGS3::kAlphaPreservedBlenderMode,
+			AGS3::kOpaqueBlenderMode,
+			AGS3::kAdditiveBlenderMode
+		};
+
+		for (uint i = 0; i < ARRAYSIZE(modes); ++i) {
+			AGS3::BlendRowProc scalar = AGS3::getBlendRowProcScalar(modes[i]);
+			AGS3::BlendRowProc fast = AGS3::getBlendRowProc(modes[i]);
+			TS_ASSERT(scalar != nullptr);
+			TS_ASSERT(fast != nullptr);
+			if (scalar)
+				checkMode(modes[i], scalar);
+			if (fast)
+				checkMode(modes[i], fast);
+		}
+	}
+
+	void test_unsupported_modes() {
+		// These are blended pixel by pixel in BITMAP::blendPixel
+		TS_ASSERT(AGS3::getBlendRowProc(AGS3::kArgbToArgbBlender) == nullptr);
+		TS_ASSERT(AGS3::getBlendRowProc(AGS3::kRgbToArgbBlender) == nullptr);
+		TS_ASSERT(AGS3::getBlendRowProc(AGS3::kTintBlenderMode) == nullptr);
+		TS_ASSERT(AGS3::getBlendRowProc(AGS3::kTintLightBlenderMode) == nullptr);
+	}
+};
@@ -127,4 +127,144 @@ class U8SortItemTestSuite : public CxxTest::TestSuite {
 		si1._fbigsq = false;
 	}
 
+	/* Display list order is by z, flats first, then by the order of addition */
+	void test_list_order() {
+		Ultima::Ultima8::SortItem si1(nullptr);
+		Ultima::Ultima8::SortItem si2(nullptr);
+
+		si1._z = 0;
+		si2._z = 8;
+		si1._sequence = 2;
+		si2._sequence = 1;
+		TS_ASSERT(si1.ListOrderLessThan(&si2));
+		TS_ASSERT(!si2.ListOrderLessThan(&si1));
+
+		// Equal z, flat goes first
+		si2._z = 0;
+		si2._flat = true;
+		TS_ASSERT(si2.ListOrderLessThan(&si1));
+		TS_ASSERT(!si1.ListOrderLessThan(&si2));
+
+		// Equal z and flatness, first added goes first
+		si2._flat = false;
+		TS_ASSERT(si2.ListOrderLessThan(&si1));
+		TS_ASSERT(!si1.ListOrderLessThan(&si2));
+	}
+
+
+	/* Items are bucketed by the 32 pixel screen columns they cover */
+	void test_column_range() {
+		Ultima::Ultima8::SortItemColumns columns;
+		Ultima::Ultima8::SortItem si(nullptr);
+		uint first, last;
+
+		columns.reset(0, 100);
+		TS_ASSERT_EQUALS(columns._columns.size(), 4U);
+
+		si._sxLeft = si._sxRight = 0;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 0U);
+		TS_ASSERT_EQUALS(last, 0U);
+
+		// Column edges
+		si._sxLeft = 31;
+		si._sxRight = 32;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 0U);
+		TS_ASSERT_EQUALS(last, 1U);
+
+		// Spanning several columns
+		si._sxLeft = 40;
+		si._sxRight = 99;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 1U);
+		TS_ASSERT_EQUALS(last, 3U);
+
+		// Left of the screen is clamped to the first column
+		si._sxLeft = -40;
+		si._sxRight = -1;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 0U);
+		TS_ASSERT_EQUALS(last, 0U);
+
+		// Right of the screen is clamped to the last column
+		si._sxLeft = -10;
+		si._sxRight = 500;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 0U);
+		TS_ASSERT_EQUALS(last, 3U);
+
+		// Columns are relative to the left of the screen
+		columns.reset(-64, 128);
+		si._sxLeft = -33;
+		si._sxRight = -32;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 0U);
+		TS_ASSERT_EQUALS(last, 1U);
+		si._sxLeft = si._sxRight = 0;
+		columns.getRange(&si, first, last);
+		TS_ASSERT_EQUALS(first, 2U);
+		TS_ASSERT_EQUALS(last, 2U);
+	}
+
+	/* Only items sharing a column are candidates, each of them once */
+	void test_column_candidates() {
+		Ultima::Ultima8::SortItemColumns columns;
+		Ultima::Ultima8::SortItem wide(nullptr);
+		Ultima::Ultima8::SortItem left(nullptr);
+		Ultima::Ultima8::SortItem right(nullptr);
+		Ultima::Ultima8::SortItem si(nullptr);
+
+		columns.reset(0, 128);
+
+		// Covers all four columns
+		wide._sxLeft = -20;
+		wide._sxRight = 127;
+		wide._sequence = 1;
+		columns.add(&wide);
+
+		left._sxLeft = 32;
+		left._sxRight = 63;
+		left._sequence = 2;
+		columns.add(&left);
+
+		right._sxLeft = 100;
+		right._sxRight = 200;
+		right._sequence = 3;
+		columns.add(&right);
+
+		// Columns 1 and 2 hold the wide and the left items
+		si._sxLeft = 40;
+		si._sxRight = 70;
+		si._sequence = 4;
+		Ultima::Std::vector<Ultima::Ultima8::SortItem *> &candidates = columns.gatherCandidates(&si);
+		TS_ASSERT_EQUALS(candidates.size(), 2U);
+		TS_ASSERT_EQUALS(candidates[0], &wide);
+		TS_ASSERT_EQUALS(candidates[1], &left);
+
+		// Negative x is in the first column, with the wide item only
+		si._sxLeft = -50;
+		si._sxRight = -10;
+		si._sequence = 5;
+		columns.gatherCandidates(&si);
+		TS_ASSERT_EQUALS(candidates.size(), 1U);
+		TS_ASSERT_EQUALS(candidates[0], &wide);
+
+		// Spanning all columns finds every item once
+		si._sxLeft = 0;
+		si._sxRight = 1000;
+		si._sequence = 6;
+		columns.gatherCandidates(&si);
+		TS_ASSERT_EQUALS(candidates.size(), 3U);
+		TS_ASSERT_EQUALS(candidates[0], &wide);
+		TS_ASSERT_EQUALS(candidates[1], &left);
+		TS_ASSERT_EQUALS(candidates[2], &right);
+
+		// Nothing is left after a reset
+		columns.reset(0, 128);
+		si._sequence = 7;
+		columns.gatherCandidates(&si);
+		TS_ASSERT_EQUALS(candidates.size(), 0U);
+	}
+
 };
@@ -0,0 +1,99 @@
+#include <cxxtest/TestSuite.h>
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/memstream.h"
+#include "image/jpeg.h"
+#include "graphics/surface.h"
+
+class JPEGDecoderTestSuite : public CxxTest::TestSuite {
+#ifdef USE_JPEG
+	// A baseline 8x8 JPEG image filled with pure red
+	static const uint8 *redJpeg(uint32 &size) {
+		static const uint8 jpegBuf[270] = {
+			0xff, 0xd8, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03,
+			0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05,
+			0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08,
+			0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12,
+			0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11,
+			0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+			0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03,
+			0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d,
+			0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00,
+			0x11, 0x08, 0x00, 0x08, 0x00, 0x08, 0x03, 0x01, 0x22, 0x00, 0x02,
+			0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x15, 0x00, 0x01,
+			0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xc4, 0x00, 0x14, 0x10,
+			0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x15, 0x01,
+			0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0xff, 0xc4, 0x00, 0x14,
+			0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x00, 0x0c,
+			0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0x9d,
+			0x00, 0x06, 0x2a, 0x9b, 0xff, 0xd9
+		};
+		size = sizeof(jpegBuf);
+		return jpegBuf;
+	}
+
+	void checkFramesReuseSurface(const Graphics::PixelFormat &format) {
+		uint32 size;
+		const uint8 *jpegBuf = redJpeg(size);
+
+		Image::JPEGDecoder decoder;
+		decoder.setOutputPixelFormat(format);
+
+		Common::MemoryReadStream stream1(jpegBuf, size);
+		const Graphics::Surface *surface = decoder.decodeFrame(stream1);
+		TS_ASSERT(surface != 0);
+		if (surface == 0) {
+			return;
+		}
+		TS_ASSERT_EQUALS(surface->w, 8);
+		TS_ASSERT_EQUALS(surface->h, 8);
+		TS_ASSERT(surface->format == format);
+		const void *pixels = surface->getPixels();
+
+		Common::MemoryReadStream stream2(jpegBuf, size);
+		surface = decoder.decodeFrame(stream2);
+		TS_ASSERT(surface != 0);
+		if (surface == 0) {
+			return;
+		}
+		TS_ASSERT(surface->format == format);
+		TS_ASSERT_EQUALS(surface->getPixels(), pixels);
+
+		uint8 a, r, g, b;
+		format.colorToARGB(surface->getPixel(3, 5), a, r, g, b);
+		TS_ASSERT_LESS_THAN(240, r);
+		TS_ASSERT_LESS_THAN(g, 16);
+		TS_ASSERT_LESS_THAN(b, 16);
+	}
+#endif
+
+public:
+	void test_decode_frames_reuse_surface() {
+#ifdef USE_JPEG
+		// Byte order RGB, output by libjpeg itself
+#ifdef SCUMM_BIG_ENDIAN
+		checkFramesReuseSurface(Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0));
+#else
+		checkFramesReuseSurface(Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0));
+#endif
+#endif
+	}
+
+	void test_decode_frames_reuse_converted_surface() {
+#ifdef USE_JPEG
+		// RGB565 is not output by libjpeg and goes through a conversion
+		checkFramesReuseSurface(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+#endif
+	}
+};
@@ -0,0 +1,72 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/matrix4.h"
+
+class Matrix4TestSuite : public CxxTest::TestSuite {
+public:
+	void test_transform() {
+		Math::Matrix4 m;
+		m.buildFromEuler(Math::Angle(20), Math::Angle(30), Math::Angle(40), Math::EO_XYZ);
+		m.setPosition(Math::Vector3d(1.f, -2.f, 3.f));
+
+		Math::Vector3d v(1.f, 0.f, 0.f);
+		m.transform(&v, false);
+		Math::Vector3d expected = m.getRotation() * Math::Vector3d(1.f, 0.f, 0.f);
+		TS_ASSERT_DELTA(v.x(), expected.x(), 1e-5f);
+		TS_ASSERT_DELTA(v.y(), expected.y(), 1e-5f);
+		TS_ASSERT_DELTA(v.z(), expected.z(), 1e-5f);
+
+		v.set(0.f, 0.f, 0.f);
+		m.transform(&v, true);
+		TS_ASSERT_DELTA(v.x(), 1.f, 1e-5f);
+		TS_ASSERT_DELTA(v.y(), -2.f, 1e-5f);
+		TS_ASSERT_DELTA(v.z(), 3.f, 1e-5f);
+	}
+
+	void test_transformArray() {
+		static const float data[16] = {
+			1.f, 2.f,  0.f,  4.f,
+			0.f, 0.f, -1.f,  5.f,
+			0.f, 3.f,  1.f, -6.f,
+			0.f, 0.f,  0.f,  1.f
+		};
+		Math::Matrix4 m;
+		m.setData(data);
+
+		// Inputs and their transforms, worked out by hand
+		static const float input[4][3] = {
+			{ 0.f,  2.f, 0.f }, { 1.5f, 1.f, 0.25f }, { 3.f, 0.f, 1.f }, { 4.5f, -1.f, 2.25f }
+		};
+		static const float translated[4][3] = {
+			{ 8.f, 5.f, 0.f }, { 7.5f, 4.75f, -2.75f }, { 7.f, 4.f, -5.f }, { 6.5f, 2.75f, -6.75f }
+		};
+		static const float rotated[4][3] = {
+			{ 4.f, 0.f, 6.f }, { 3.5f, -0.25f, 3.25f }, { 3.f, -1.f, 1.f }, { 2.5f, -2.25f, -0.75f }
+		};
+
+		// Interleaved buffer: three position floats followed by one padding float
+		float buffer[4 * 4];
+		Math::Vector3d points[4];
+		for (int i = 0; i < 4; ++i) {
+			buffer[i * 4 + 0] = input[i][0];
+			buffer[i * 4 + 1] = input[i][1];
+			buffer[i * 4 + 2] = input[i][2];
+			buffer[i * 4 + 3] = 42.f;
+			points[i].set(input[i][0], input[i][1], input[i][2]);
+		}
+
+		m.transform(buffer, 4, buffer, 4, 4, true);
+		m.transform(points, points, 4, false);
+
+		for (int i = 0; i < 4; ++i) {
+			TS_ASSERT_DELTA(buffer[i * 4 + 0], translated[i][0], 1e-5f);
+			TS_ASSERT_DELTA(buffer[i * 4 + 1], translated[i][1], 1e-5f);
+			TS_ASSERT_DELTA(buffer[i * 4 + 2], translated[i][2], 1e-5f);
+			TS_ASSERT_EQUALS(buffer[i * 4 + 3], 42.f);
+
+			TS_ASSERT_DELTA(points[i].x(), rotated[i][0], 1e-5f);
+			TS_ASSERT_DELTA(points[i].y(), rotated[i][1], 1e-5f);
+			TS_ASSERT_DELTA(points[i].z(), rotated[i][2], 1e-5f);
+		}
+	}
+};
@@ -35,6 +35,11 @@ ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TEST_LIBS += engines/wintermute/libwintermute.a
 endif
 
+ifeq ($(ENABLE_AGS), STATIC_PLUGIN)
+	TESTS += $(srcdir)/test/engines/ags/*.h
+	TEST_LIBS += engines/ags/libags.a
+endif
+
 ifeq ($(ENABLE_ULTIMA), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/ultima/*/*/*.h
 	TEST_LIBS += engines/ultima/libultima.a